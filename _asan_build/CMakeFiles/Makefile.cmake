@@ -0,0 +1,183 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/Modules/ECMEnableSanitizers.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/Version.cpp.in"
+  "/root/repo/src/allocator/CMakeLists.txt"
+  "/root/repo/src/concurrency/CMakeLists.txt"
+  "/root/repo/src/coroutine/CMakeLists.txt"
+  "/root/repo/src/execute/CMakeLists.txt"
+  "/root/repo/src/logging/CMakeLists.txt"
+  "/root/repo/src/network/CMakeLists.txt"
+  "/root/repo/src/protocol/CMakeLists.txt"
+  "/root/repo/src/storage/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/concurrency/CMakeLists.txt"
+  "/root/repo/test/coroutine/CMakeLists.txt"
+  "/root/repo/test/execute/CMakeLists.txt"
+  "/root/repo/test/protocol/CMakeLists.txt"
+  "/root/repo/test/storage/CMakeLists.txt"
+  "/root/repo/third-party/backward-cpp/BackwardConfig.cmake"
+  "/root/repo/third-party/backward-cpp/CMakeLists.txt"
+  "/root/repo/third-party/cxxopts-1.4.3/CMakeLists.txt"
+  "/root/repo/third-party/cxxopts-1.4.3/cxxopts-config.cmake.in"
+  "/root/repo/third-party/cxxopts-1.4.3/src/CMakeLists.txt"
+  "/root/repo/third-party/cxxopts-1.4.3/test/CMakeLists.txt"
+  "/root/repo/third-party/googletest-release-1.8.0/CMakeLists.txt"
+  "/root/repo/third-party/googletest-release-1.8.0/googlemock/CMakeLists.txt"
+  "/root/repo/third-party/googletest-release-1.8.0/googletest/CMakeLists.txt"
+  "/root/repo/third-party/googletest-release-1.8.0/googletest/cmake/internal_utils.cmake"
+  "/root/repo/third-party/spdlog-0.13.0/CMakeLists.txt"
+  "/root/repo/third-party/spdlog-0.13.0/cmake/Config.cmake.in"
+  "/root/repo/third-party/spdlog-0.13.0/cmake/spdlog.pc.in"
+  "/root/repo/third-party/spdlog-0.13.0/tests/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third-party/googletest-release-1.8.0/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third-party/googletest-release-1.8.0/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third-party/googletest-release-1.8.0/googlemock/gtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third-party/spdlog-0.13.0/DartConfiguration.tcl"
+  "third-party/spdlog-0.13.0/generated/spdlogConfigVersion.cmake"
+  "third-party/spdlog-0.13.0/generated/spdlogConfig.cmake"
+  "third-party/spdlog-0.13.0/generated/spdlog.pc"
+  "third-party/spdlog-0.13.0/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third-party/spdlog-0.13.0/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third-party/backward-cpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third-party/cxxopts-1.4.3/cxxopts-config-version.cmake"
+  "third-party/cxxopts-1.4.3/cxxopts-config.cmake"
+  "third-party/cxxopts-1.4.3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third-party/cxxopts-1.4.3/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third-party/cxxopts-1.4.3/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/Version.cpp"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/allocator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/concurrency/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/coroutine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/logging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/execute/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/protocol/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/network/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/concurrency/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/coroutine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/execute/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/protocol/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/storage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "third-party/googletest-release-1.8.0/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "third-party/googletest-release-1.8.0/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "third-party/googletest-release-1.8.0/googlemock/gtest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "third-party/googletest-release-1.8.0/googlemock/gtest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/CMakeFiles/spdlog_headers_for_ide.dir/DependInfo.cmake"
+  "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/DependInfo.cmake"
+  "third-party/backward-cpp/CMakeFiles/backward_object.dir/DependInfo.cmake"
+  "third-party/backward-cpp/CMakeFiles/backward.dir/DependInfo.cmake"
+  "src/CMakeFiles/afina.dir/DependInfo.cmake"
+  "src/allocator/CMakeFiles/Allocator.dir/DependInfo.cmake"
+  "src/concurrency/CMakeFiles/Concurrency.dir/DependInfo.cmake"
+  "src/coroutine/CMakeFiles/Coroutine.dir/DependInfo.cmake"
+  "src/logging/CMakeFiles/Logging.dir/DependInfo.cmake"
+  "src/execute/CMakeFiles/Execute.dir/DependInfo.cmake"
+  "src/protocol/CMakeFiles/Protocol.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/Network.dir/DependInfo.cmake"
+  "src/storage/CMakeFiles/Storage.dir/DependInfo.cmake"
+  "test/concurrency/CMakeFiles/runConcurrencyTests.dir/DependInfo.cmake"
+  "test/concurrency/CMakeFiles/runIdBenchmark.dir/DependInfo.cmake"
+  "test/concurrency/CMakeFiles/runCounterBenchmark.dir/DependInfo.cmake"
+  "test/coroutine/CMakeFiles/runCoroutineTests.dir/DependInfo.cmake"
+  "test/execute/CMakeFiles/runExecuteTests.dir/DependInfo.cmake"
+  "test/protocol/CMakeFiles/runProtocolTests.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/runStorageTests.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/runIndexBenchmark.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/runTraceBenchmark.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_asan_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("third-party/googletest-release-1.8.0")
+subdirs("third-party/spdlog-0.13.0")
+subdirs("third-party/backward-cpp")
+subdirs("third-party/cxxopts-1.4.3")
+subdirs("src")
+subdirs("test")
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_asan_build/src/Version.cpp" "src/CMakeFiles/afina.dir/Version.cpp.o" "gcc" "src/CMakeFiles/afina.dir/Version.cpp.o.d"
+  "/root/repo/src/main.cpp" "src/CMakeFiles/afina.dir/main.cpp.o" "gcc" "src/CMakeFiles/afina.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/src/logging/CMakeFiles/Logging.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/src/concurrency/CMakeFiles/Concurrency.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/src/network/CMakeFiles/Network.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/src/storage/CMakeFiles/Storage.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/src/protocol/CMakeFiles/Protocol.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/src/execute/CMakeFiles/Execute.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/afina.dir/Version.cpp.o"
+  "CMakeFiles/afina.dir/Version.cpp.o.d"
+  "CMakeFiles/afina.dir/main.cpp.o"
+  "CMakeFiles/afina.dir/main.cpp.o.d"
+  "afina"
+  "afina.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/afina.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Allocator.dir/Pointer.cpp.o"
+  "CMakeFiles/Allocator.dir/Pointer.cpp.o.d"
+  "CMakeFiles/Allocator.dir/Simple.cpp.o"
+  "CMakeFiles/Allocator.dir/Simple.cpp.o.d"
+  "libAllocator.a"
+  "libAllocator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Allocator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Concurrency.dir/Executor.cpp.o"
+  "CMakeFiles/Concurrency.dir/Executor.cpp.o.d"
+  "libConcurrency.a"
+  "libConcurrency.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Concurrency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Coroutine.dir/Engine.cpp.o"
+  "CMakeFiles/Coroutine.dir/Engine.cpp.o.d"
+  "libCoroutine.a"
+  "libCoroutine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Coroutine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
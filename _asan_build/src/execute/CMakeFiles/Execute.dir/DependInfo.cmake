@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/execute/Add.cpp" "src/execute/CMakeFiles/Execute.dir/Add.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Add.cpp.o.d"
+  "/root/repo/src/execute/Append.cpp" "src/execute/CMakeFiles/Execute.dir/Append.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Append.cpp.o.d"
+  "/root/repo/src/execute/Cas.cpp" "src/execute/CMakeFiles/Execute.dir/Cas.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Cas.cpp.o.d"
+  "/root/repo/src/execute/Command.cpp" "src/execute/CMakeFiles/Execute.dir/Command.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Command.cpp.o.d"
+  "/root/repo/src/execute/Decr.cpp" "src/execute/CMakeFiles/Execute.dir/Decr.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Decr.cpp.o.d"
+  "/root/repo/src/execute/Get.cpp" "src/execute/CMakeFiles/Execute.dir/Get.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Get.cpp.o.d"
+  "/root/repo/src/execute/Incr.cpp" "src/execute/CMakeFiles/Execute.dir/Incr.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Incr.cpp.o.d"
+  "/root/repo/src/execute/InsertCommand.cpp" "src/execute/CMakeFiles/Execute.dir/InsertCommand.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/InsertCommand.cpp.o.d"
+  "/root/repo/src/execute/Prepend.cpp" "src/execute/CMakeFiles/Execute.dir/Prepend.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Prepend.cpp.o.d"
+  "/root/repo/src/execute/Replace.cpp" "src/execute/CMakeFiles/Execute.dir/Replace.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Replace.cpp.o.d"
+  "/root/repo/src/execute/Response.cpp" "src/execute/CMakeFiles/Execute.dir/Response.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Response.cpp.o.d"
+  "/root/repo/src/execute/Set.cpp" "src/execute/CMakeFiles/Execute.dir/Set.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Set.cpp.o.d"
+  "/root/repo/src/execute/Stats.cpp" "src/execute/CMakeFiles/Execute.dir/Stats.cpp.o" "gcc" "src/execute/CMakeFiles/Execute.dir/Stats.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/src/storage/CMakeFiles/Storage.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Execute.dir/Add.cpp.o"
+  "CMakeFiles/Execute.dir/Add.cpp.o.d"
+  "CMakeFiles/Execute.dir/Append.cpp.o"
+  "CMakeFiles/Execute.dir/Append.cpp.o.d"
+  "CMakeFiles/Execute.dir/Cas.cpp.o"
+  "CMakeFiles/Execute.dir/Cas.cpp.o.d"
+  "CMakeFiles/Execute.dir/Command.cpp.o"
+  "CMakeFiles/Execute.dir/Command.cpp.o.d"
+  "CMakeFiles/Execute.dir/Decr.cpp.o"
+  "CMakeFiles/Execute.dir/Decr.cpp.o.d"
+  "CMakeFiles/Execute.dir/Get.cpp.o"
+  "CMakeFiles/Execute.dir/Get.cpp.o.d"
+  "CMakeFiles/Execute.dir/Incr.cpp.o"
+  "CMakeFiles/Execute.dir/Incr.cpp.o.d"
+  "CMakeFiles/Execute.dir/InsertCommand.cpp.o"
+  "CMakeFiles/Execute.dir/InsertCommand.cpp.o.d"
+  "CMakeFiles/Execute.dir/Prepend.cpp.o"
+  "CMakeFiles/Execute.dir/Prepend.cpp.o.d"
+  "CMakeFiles/Execute.dir/Replace.cpp.o"
+  "CMakeFiles/Execute.dir/Replace.cpp.o.d"
+  "CMakeFiles/Execute.dir/Response.cpp.o"
+  "CMakeFiles/Execute.dir/Response.cpp.o.d"
+  "CMakeFiles/Execute.dir/Set.cpp.o"
+  "CMakeFiles/Execute.dir/Set.cpp.o.d"
+  "CMakeFiles/Execute.dir/Stats.cpp.o"
+  "CMakeFiles/Execute.dir/Stats.cpp.o.d"
+  "libExecute.a"
+  "libExecute.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Execute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Logging.dir/ServiceImpl.cpp.o"
+  "CMakeFiles/Logging.dir/ServiceImpl.cpp.o.d"
+  "libLogging.a"
+  "libLogging.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Logging.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/network/mt_blocking/ServerImpl.cpp" "src/network/CMakeFiles/Network.dir/mt_blocking/ServerImpl.cpp.o" "gcc" "src/network/CMakeFiles/Network.dir/mt_blocking/ServerImpl.cpp.o.d"
+  "/root/repo/src/network/mt_nonblocking/Connection.cpp" "src/network/CMakeFiles/Network.dir/mt_nonblocking/Connection.cpp.o" "gcc" "src/network/CMakeFiles/Network.dir/mt_nonblocking/Connection.cpp.o.d"
+  "/root/repo/src/network/mt_nonblocking/IdleTimers.cpp" "src/network/CMakeFiles/Network.dir/mt_nonblocking/IdleTimers.cpp.o" "gcc" "src/network/CMakeFiles/Network.dir/mt_nonblocking/IdleTimers.cpp.o.d"
+  "/root/repo/src/network/mt_nonblocking/ServerImpl.cpp" "src/network/CMakeFiles/Network.dir/mt_nonblocking/ServerImpl.cpp.o" "gcc" "src/network/CMakeFiles/Network.dir/mt_nonblocking/ServerImpl.cpp.o.d"
+  "/root/repo/src/network/mt_nonblocking/Utils.cpp" "src/network/CMakeFiles/Network.dir/mt_nonblocking/Utils.cpp.o" "gcc" "src/network/CMakeFiles/Network.dir/mt_nonblocking/Utils.cpp.o.d"
+  "/root/repo/src/network/mt_nonblocking/Worker.cpp" "src/network/CMakeFiles/Network.dir/mt_nonblocking/Worker.cpp.o" "gcc" "src/network/CMakeFiles/Network.dir/mt_nonblocking/Worker.cpp.o.d"
+  "/root/repo/src/network/st_blocking/ServerImpl.cpp" "src/network/CMakeFiles/Network.dir/st_blocking/ServerImpl.cpp.o" "gcc" "src/network/CMakeFiles/Network.dir/st_blocking/ServerImpl.cpp.o.d"
+  "/root/repo/src/network/st_nonblocking/Connection.cpp" "src/network/CMakeFiles/Network.dir/st_nonblocking/Connection.cpp.o" "gcc" "src/network/CMakeFiles/Network.dir/st_nonblocking/Connection.cpp.o.d"
+  "/root/repo/src/network/st_nonblocking/ServerImpl.cpp" "src/network/CMakeFiles/Network.dir/st_nonblocking/ServerImpl.cpp.o" "gcc" "src/network/CMakeFiles/Network.dir/st_nonblocking/ServerImpl.cpp.o.d"
+  "/root/repo/src/network/st_nonblocking/Utils.cpp" "src/network/CMakeFiles/Network.dir/st_nonblocking/Utils.cpp.o" "gcc" "src/network/CMakeFiles/Network.dir/st_nonblocking/Utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/src/logging/CMakeFiles/Logging.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/src/protocol/CMakeFiles/Protocol.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/src/execute/CMakeFiles/Execute.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/src/storage/CMakeFiles/Storage.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Network.dir/mt_blocking/ServerImpl.cpp.o"
+  "CMakeFiles/Network.dir/mt_blocking/ServerImpl.cpp.o.d"
+  "CMakeFiles/Network.dir/mt_nonblocking/Connection.cpp.o"
+  "CMakeFiles/Network.dir/mt_nonblocking/Connection.cpp.o.d"
+  "CMakeFiles/Network.dir/mt_nonblocking/IdleTimers.cpp.o"
+  "CMakeFiles/Network.dir/mt_nonblocking/IdleTimers.cpp.o.d"
+  "CMakeFiles/Network.dir/mt_nonblocking/ServerImpl.cpp.o"
+  "CMakeFiles/Network.dir/mt_nonblocking/ServerImpl.cpp.o.d"
+  "CMakeFiles/Network.dir/mt_nonblocking/Utils.cpp.o"
+  "CMakeFiles/Network.dir/mt_nonblocking/Utils.cpp.o.d"
+  "CMakeFiles/Network.dir/mt_nonblocking/Worker.cpp.o"
+  "CMakeFiles/Network.dir/mt_nonblocking/Worker.cpp.o.d"
+  "CMakeFiles/Network.dir/st_blocking/ServerImpl.cpp.o"
+  "CMakeFiles/Network.dir/st_blocking/ServerImpl.cpp.o.d"
+  "CMakeFiles/Network.dir/st_nonblocking/Connection.cpp.o"
+  "CMakeFiles/Network.dir/st_nonblocking/Connection.cpp.o.d"
+  "CMakeFiles/Network.dir/st_nonblocking/ServerImpl.cpp.o"
+  "CMakeFiles/Network.dir/st_nonblocking/ServerImpl.cpp.o.d"
+  "CMakeFiles/Network.dir/st_nonblocking/Utils.cpp.o"
+  "CMakeFiles/Network.dir/st_nonblocking/Utils.cpp.o.d"
+  "libNetwork.a"
+  "libNetwork.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Network.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Protocol.dir/Parser.cpp.o"
+  "CMakeFiles/Protocol.dir/Parser.cpp.o.d"
+  "libProtocol.a"
+  "libProtocol.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Protocol.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
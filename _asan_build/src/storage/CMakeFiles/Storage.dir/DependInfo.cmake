@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/storage/ExpirySweeper.cpp" "src/storage/CMakeFiles/Storage.dir/ExpirySweeper.cpp.o" "gcc" "src/storage/CMakeFiles/Storage.dir/ExpirySweeper.cpp.o.d"
+  "/root/repo/src/storage/FrequencySketch.cpp" "src/storage/CMakeFiles/Storage.dir/FrequencySketch.cpp.o" "gcc" "src/storage/CMakeFiles/Storage.dir/FrequencySketch.cpp.o.d"
+  "/root/repo/src/storage/ShardedLRU.cpp" "src/storage/CMakeFiles/Storage.dir/ShardedLRU.cpp.o" "gcc" "src/storage/CMakeFiles/Storage.dir/ShardedLRU.cpp.o.d"
+  "/root/repo/src/storage/SimpleClock.cpp" "src/storage/CMakeFiles/Storage.dir/SimpleClock.cpp.o" "gcc" "src/storage/CMakeFiles/Storage.dir/SimpleClock.cpp.o.d"
+  "/root/repo/src/storage/SimpleLRU.cpp" "src/storage/CMakeFiles/Storage.dir/SimpleLRU.cpp.o" "gcc" "src/storage/CMakeFiles/Storage.dir/SimpleLRU.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
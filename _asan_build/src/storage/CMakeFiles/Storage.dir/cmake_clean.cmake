@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Storage.dir/ExpirySweeper.cpp.o"
+  "CMakeFiles/Storage.dir/ExpirySweeper.cpp.o.d"
+  "CMakeFiles/Storage.dir/FrequencySketch.cpp.o"
+  "CMakeFiles/Storage.dir/FrequencySketch.cpp.o.d"
+  "CMakeFiles/Storage.dir/ShardedLRU.cpp.o"
+  "CMakeFiles/Storage.dir/ShardedLRU.cpp.o.d"
+  "CMakeFiles/Storage.dir/SimpleClock.cpp.o"
+  "CMakeFiles/Storage.dir/SimpleClock.cpp.o.d"
+  "CMakeFiles/Storage.dir/SimpleLRU.cpp.o"
+  "CMakeFiles/Storage.dir/SimpleLRU.cpp.o.d"
+  "libStorage.a"
+  "libStorage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/concurrency/CoreLocalTest.cpp" "test/concurrency/CMakeFiles/runConcurrencyTests.dir/CoreLocalTest.cpp.o" "gcc" "test/concurrency/CMakeFiles/runConcurrencyTests.dir/CoreLocalTest.cpp.o.d"
+  "/root/repo/test/concurrency/FlatCombineTest.cpp" "test/concurrency/CMakeFiles/runConcurrencyTests.dir/FlatCombineTest.cpp.o" "gcc" "test/concurrency/CMakeFiles/runConcurrencyTests.dir/FlatCombineTest.cpp.o.d"
+  "/root/repo/test/concurrency/ThreadLocalTest.cpp" "test/concurrency/CMakeFiles/runConcurrencyTests.dir/ThreadLocalTest.cpp.o" "gcc" "test/concurrency/CMakeFiles/runConcurrencyTests.dir/ThreadLocalTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/third-party/googletest-release-1.8.0/googlemock/gtest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/third-party/googletest-release-1.8.0/googlemock/gtest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
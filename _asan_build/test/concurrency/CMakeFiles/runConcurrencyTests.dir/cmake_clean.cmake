@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runConcurrencyTests.dir/CoreLocalTest.cpp.o"
+  "CMakeFiles/runConcurrencyTests.dir/CoreLocalTest.cpp.o.d"
+  "CMakeFiles/runConcurrencyTests.dir/FlatCombineTest.cpp.o"
+  "CMakeFiles/runConcurrencyTests.dir/FlatCombineTest.cpp.o.d"
+  "CMakeFiles/runConcurrencyTests.dir/ThreadLocalTest.cpp.o"
+  "CMakeFiles/runConcurrencyTests.dir/ThreadLocalTest.cpp.o.d"
+  "runConcurrencyTests"
+  "runConcurrencyTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runConcurrencyTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runCounterBenchmark.dir/CounterBenchmark.cpp.o"
+  "CMakeFiles/runCounterBenchmark.dir/CounterBenchmark.cpp.o.d"
+  "runCounterBenchmark"
+  "runCounterBenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runCounterBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runIdBenchmark.dir/IdBenchmark.cpp.o"
+  "CMakeFiles/runIdBenchmark.dir/IdBenchmark.cpp.o.d"
+  "runIdBenchmark"
+  "runIdBenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runIdBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/concurrency
+# Build directory: /root/repo/_asan_build/test/concurrency
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(runConcurrencyTests "runConcurrencyTests")
+set_tests_properties(runConcurrencyTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/concurrency/CMakeLists.txt;12;add_test;/root/repo/test/concurrency/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runCoroutineTests.dir/EngineTest.cpp.o"
+  "CMakeFiles/runCoroutineTests.dir/EngineTest.cpp.o.d"
+  "runCoroutineTests"
+  "runCoroutineTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runCoroutineTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
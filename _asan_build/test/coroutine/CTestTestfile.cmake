@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/coroutine
+# Build directory: /root/repo/_asan_build/test/coroutine
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(runCoroutineTests "runCoroutineTests")
+set_tests_properties(runCoroutineTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coroutine/CMakeLists.txt;10;add_test;/root/repo/test/coroutine/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runExecuteTests.dir/ExecuteTest.cpp.o"
+  "CMakeFiles/runExecuteTests.dir/ExecuteTest.cpp.o.d"
+  "runExecuteTests"
+  "runExecuteTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runExecuteTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
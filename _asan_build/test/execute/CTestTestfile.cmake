@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/execute
+# Build directory: /root/repo/_asan_build/test/execute
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(runExecuteTests "runExecuteTests")
+set_tests_properties(runExecuteTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/execute/CMakeLists.txt;10;add_test;/root/repo/test/execute/CMakeLists.txt;0;")
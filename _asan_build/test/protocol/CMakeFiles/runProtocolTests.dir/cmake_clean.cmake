@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runProtocolTests.dir/MemcachedParserTest.cpp.o"
+  "CMakeFiles/runProtocolTests.dir/MemcachedParserTest.cpp.o.d"
+  "runProtocolTests"
+  "runProtocolTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runProtocolTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/protocol
+# Build directory: /root/repo/_asan_build/test/protocol
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(runProtocolTests "runProtocolTests")
+set_tests_properties(runProtocolTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/protocol/CMakeLists.txt;10;add_test;/root/repo/test/protocol/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runIndexBenchmark.dir/IndexBenchmark.cpp.o"
+  "CMakeFiles/runIndexBenchmark.dir/IndexBenchmark.cpp.o.d"
+  "runIndexBenchmark"
+  "runIndexBenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runIndexBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runStorageTests.dir/StorageTest.cpp.o"
+  "CMakeFiles/runStorageTests.dir/StorageTest.cpp.o.d"
+  "CMakeFiles/runStorageTests.dir/TimingWheelTest.cpp.o"
+  "CMakeFiles/runStorageTests.dir/TimingWheelTest.cpp.o.d"
+  "runStorageTests"
+  "runStorageTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runStorageTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runTraceBenchmark.dir/TraceBenchmark.cpp.o"
+  "CMakeFiles/runTraceBenchmark.dir/TraceBenchmark.cpp.o.d"
+  "runTraceBenchmark"
+  "runTraceBenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runTraceBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/storage
+# Build directory: /root/repo/_asan_build/test/storage
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(runStorageTests "runStorageTests")
+set_tests_properties(runStorageTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/storage/CMakeLists.txt;11;add_test;/root/repo/test/storage/CMakeLists.txt;0;")
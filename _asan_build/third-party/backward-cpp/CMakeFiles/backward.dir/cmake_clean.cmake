@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/backward.dir/backward.cpp.o"
+  "CMakeFiles/backward.dir/backward.cpp.o.d"
+  "libbackward.a"
+  "libbackward.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/backward.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
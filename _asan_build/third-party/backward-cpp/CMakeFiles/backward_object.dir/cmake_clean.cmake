@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/backward_object.dir/backward.cpp.o"
+  "CMakeFiles/backward_object.dir/backward.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/backward_object.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
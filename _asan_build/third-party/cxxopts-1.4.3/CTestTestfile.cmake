@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/third-party/cxxopts-1.4.3
+# Build directory: /root/repo/_asan_build/third-party/cxxopts-1.4.3
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src")
+subdirs("test")
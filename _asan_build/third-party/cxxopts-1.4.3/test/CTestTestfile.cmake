@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/third-party/cxxopts-1.4.3/test
+# Build directory: /root/repo/_asan_build/third-party/cxxopts-1.4.3/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
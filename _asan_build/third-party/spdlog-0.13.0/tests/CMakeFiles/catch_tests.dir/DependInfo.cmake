@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third-party/spdlog-0.13.0/tests/errors.cpp" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/errors.cpp.o" "gcc" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/errors.cpp.o.d"
+  "/root/repo/third-party/spdlog-0.13.0/tests/file_helper.cpp" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/file_helper.cpp.o" "gcc" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/file_helper.cpp.o.d"
+  "/root/repo/third-party/spdlog-0.13.0/tests/file_log.cpp" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/file_log.cpp.o" "gcc" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/file_log.cpp.o.d"
+  "/root/repo/third-party/spdlog-0.13.0/tests/format.cpp" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/format.cpp.o" "gcc" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/format.cpp.o.d"
+  "/root/repo/third-party/spdlog-0.13.0/tests/main.cpp" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/main.cpp.o" "gcc" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/main.cpp.o.d"
+  "/root/repo/third-party/spdlog-0.13.0/tests/registry.cpp" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/registry.cpp.o" "gcc" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/registry.cpp.o.d"
+  "/root/repo/third-party/spdlog-0.13.0/tests/utils.cpp" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/utils.cpp.o" "gcc" "third-party/spdlog-0.13.0/tests/CMakeFiles/catch_tests.dir/utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
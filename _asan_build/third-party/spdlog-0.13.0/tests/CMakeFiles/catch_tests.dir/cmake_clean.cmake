@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/catch_tests.dir/errors.cpp.o"
+  "CMakeFiles/catch_tests.dir/errors.cpp.o.d"
+  "CMakeFiles/catch_tests.dir/file_helper.cpp.o"
+  "CMakeFiles/catch_tests.dir/file_helper.cpp.o.d"
+  "CMakeFiles/catch_tests.dir/file_log.cpp.o"
+  "CMakeFiles/catch_tests.dir/file_log.cpp.o.d"
+  "CMakeFiles/catch_tests.dir/format.cpp.o"
+  "CMakeFiles/catch_tests.dir/format.cpp.o.d"
+  "CMakeFiles/catch_tests.dir/main.cpp.o"
+  "CMakeFiles/catch_tests.dir/main.cpp.o.d"
+  "CMakeFiles/catch_tests.dir/registry.cpp.o"
+  "CMakeFiles/catch_tests.dir/registry.cpp.o.d"
+  "CMakeFiles/catch_tests.dir/utils.cpp.o"
+  "CMakeFiles/catch_tests.dir/utils.cpp.o.d"
+  "catch_tests"
+  "catch_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/catch_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
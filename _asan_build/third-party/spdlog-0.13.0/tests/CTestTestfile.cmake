@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/third-party/spdlog-0.13.0/tests
+# Build directory: /root/repo/_asan_build/third-party/spdlog-0.13.0/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(catch_tests "/root/repo/_asan_build/third-party/spdlog-0.13.0/tests/catch_tests")
+set_tests_properties(catch_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/third-party/spdlog-0.13.0/tests/CMakeLists.txt;17;add_test;/root/repo/third-party/spdlog-0.13.0/tests/CMakeLists.txt;0;")
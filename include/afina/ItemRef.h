@@ -0,0 +1,90 @@
+#ifndef AFINA_ITEM_REF_H
+#define AFINA_ITEM_REF_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Afina {
+
+/**
+ * # Pinned value of the storage item
+ * Points to value bytes right in the storage memory and holds one reference to the item owning them, so the
+ * bytes stay valid and unchanged after the storage lock is released, even if the item gets evicted, deleted or
+ * overwritten meanwhile. Reference is dropped once handle is destroyed or reset, from any thread.
+ *
+ * Handle could be moved but not copied, each one owns exactly one reference
+ */
+class ItemRef {
+public:
+    // Drops reference to the owner, called at most once per handle
+    using Release = void (*)(void *owner);
+
+    ItemRef() : _data(nullptr), _size(0), _flags(0), _cas(0), _owner(nullptr), _release(nullptr) {}
+
+    /**
+     * @param cas version of the item, see Storage::Cas
+     * @param owner object data belongs to, caller must have taken a reference to it already
+     * @param release function dropping that reference
+     */
+    ItemRef(const char *data, size_t size, uint32_t flags, uint64_t cas, void *owner, Release release)
+        : _data(data), _size(size), _flags(flags), _cas(cas), _owner(owner), _release(release) {}
+
+    ItemRef(ItemRef &&other) noexcept
+        : _data(other._data), _size(other._size), _flags(other._flags), _cas(other._cas), _owner(other._owner),
+          _release(other._release) {
+        other._owner = nullptr;
+        other._release = nullptr;
+    }
+
+    ItemRef &operator=(ItemRef &&other) noexcept {
+        if (this != &other) {
+            Reset();
+            _data = other._data;
+            _size = other._size;
+            _flags = other._flags;
+            _cas = other._cas;
+            _owner = other._owner;
+            _release = other._release;
+            other._owner = nullptr;
+            other._release = nullptr;
+        }
+        return *this;
+    }
+
+    ItemRef(const ItemRef &) = delete;
+    ItemRef &operator=(const ItemRef &) = delete;
+
+    ~ItemRef() { Reset(); }
+
+    // Drops the reference, handle becomes empty
+    void Reset() {
+        if (_release != nullptr) {
+            _release(_owner);
+        }
+        _data = nullptr;
+        _size = 0;
+        _flags = 0;
+        _cas = 0;
+        _owner = nullptr;
+        _release = nullptr;
+    }
+
+    inline const char *data() const { return _data; }
+    inline size_t size() const { return _size; }
+    inline uint32_t flags() const { return _flags; }
+    inline uint64_t cas() const { return _cas; }
+    inline bool empty() const { return _owner == nullptr; }
+
+private:
+    const char *_data;
+    size_t _size;
+    uint32_t _flags;
+    uint64_t _cas;
+
+    void *_owner;
+    Release _release;
+};
+
+} // namespace Afina
+
+#endif // AFINA_ITEM_REF_H
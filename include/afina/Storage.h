@@ -1,7 +1,11 @@
 #ifndef AFINA_STORAGE_H
 #define AFINA_STORAGE_H
 
+#include <cstdint>
 #include <string>
+#include <vector>
+
+#include <afina/ItemRef.h>
 
 namespace Afina {
 
@@ -10,10 +14,28 @@ namespace Afina {
  */
 class Storage {
 public:
+    // Outcome of Cas
+    enum class CasResult {
+        // Value has been updated
+        kStored,
+
+        // Versions match, but value couldn't be stored, e.g. it is too big
+        kNotStored,
+
+        // Item has been modified since the given version was read
+        kExists,
+
+        // There is no such key
+        kNotFound
+    };
+
     Storage() {}
     virtual ~Storage() {}
 
+    // Starts background maintenance of the storage if it has any, e.g. sweeping of expired items
     virtual void Start() {}
+
+    // Stops background maintenance
     virtual void Stop() {}
 
     /**
@@ -27,8 +49,10 @@ public:
      *
      * @param key to be associated with value
      * @param value to be assigned for the key
+     * @param expire unix time in seconds since which association is not visible anymore, 0 means never
+     * @param flags opaque client data stored along with the value and returned by Get
      */
-    virtual bool Put(const std::string &key, const std::string &value) = 0;
+    virtual bool Put(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) = 0;
 
     /**
      * Stores association between given key/value pair if key isn't present in
@@ -38,10 +62,15 @@ public:
      * and doesn't change anything inside. Otherwise new association key->value
      * created and if successful then true returns.
      *
+     * Expired association is considered absent.
+     *
      * @param key to be associated with value
      * @param value to be assigned for the key
+     * @param expire unix time in seconds since which association is not visible anymore, 0 means never
+     * @param flags opaque client data stored along with the value and returned by Get
      */
-    virtual bool PutIfAbsent(const std::string &key, const std::string &value) = 0;
+    virtual bool PutIfAbsent(const std::string &key, const std::string &value, uint32_t expire = 0,
+                             uint32_t flags = 0) = 0;
 
     /**
      * Updates existing association between given key/value pair
@@ -53,8 +82,57 @@ public:
      *
      * @param key to be associated with value
      * @param value to be assigned for the key
+     * @param expire unix time in seconds since which association is not visible anymore, 0 means never
+     * @param flags opaque client data stored along with the value and returned by Get
+     */
+    virtual bool Set(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) = 0;
+
+    /**
+     * Check-and-set: updates existing association only if nobody has modified it since the client read it.
+     * Every modification of the item gives it a new version, that is returned along with the value by GetRef
+     * and MultiGet, see ItemRef::cas. Versions are unique per key only, not across keys.
+     *
+     * @param key to be updated
+     * @param value to be assigned for the key
+     * @param cas version of the item client has read
+     * @param expire see Put
+     * @param flags see Put
+     */
+    virtual CasResult Cas(const std::string &key, const std::string &value, uint64_t cas, uint32_t expire = 0,
+                          uint32_t flags = 0) = 0;
+
+    /**
+     * Adds data to the end of the existing value, flags and expiration time of the association stay the same.
+     * If requested key doesn't present in storage method returns false and doesnt change anything.
+     *
+     * Lookup and update are done atomically, storage could grow value in place
+     *
+     * @param key to update value for
+     * @param data to be appended
+     */
+    virtual bool Append(const std::string &key, const std::string &data) = 0;
+
+    /**
+     * Same as Append, but adds data before the existing value
+     */
+    virtual bool Prepend(const std::string &key, const std::string &data) = 0;
+
+    /**
+     * Treats value as decimal unsigned 64 bit number and adds delta to it in place, wrapping around at 2^64.
+     * Flags and expiration time stay the same. If requested key doesn't present in storage method returns
+     * false and doesnt change anything.
+     *
+     * @param key of the counter
+     * @param delta to be added
+     * @param result output parameter, new value of the counter
+     * @throws std::invalid_argument if value isn't a number
+     */
+    virtual bool Incr(const std::string &key, uint64_t delta, uint64_t &result) = 0;
+
+    /**
+     * Same as Incr, but subtracts delta, counter never goes below 0
      */
-    virtual bool Set(const std::string &key, const std::string &value) = 0;
+    virtual bool Decr(const std::string &key, uint64_t delta, uint64_t &result) = 0;
 
     /**
      * Removes association for the given key
@@ -77,13 +155,58 @@ public:
      * If there is an association for the given key then method copies value
      * into given output parameter (possibly extends its size) and return true
      *
-     * In case if given key not found method returns false and doesn't perform
-     * any changes on the output parameter
+     * In case if given key not found or association has expired method returns
+     * false and doesn't perform any changes on the output parameter
      *
      * @param key to retrive1 value for
      * @param value output parameter to copy value to
+     * @param flags optional output parameter to copy flags of the value to
+     */
+    virtual bool Get(const std::string &key, std::string &value, uint32_t *flags = nullptr) = 0;
+
+    /**
+     * Same as Get, but instead of copying value out returns handle pinning it in the storage memory, so that
+     * value could be sent to the network right from there. Handle keeps value valid and unchanged until it is
+     * released, whatever happens to the key meanwhile.
+     *
+     * Default implementation copies value into the handle, storages keeping values in their own memory
+     * should override it.
+     *
+     * @param key to retrive value for
+     * @param item output parameter, previous value is released
+     */
+    virtual bool GetRef(const std::string &key, ItemRef &item) {
+        std::string *value = new std::string;
+        uint32_t flags;
+        if (!Get(key, *value, &flags)) {
+            delete value;
+            return false;
+        }
+        item = ItemRef(value->data(), value->size(), flags, 0, value,
+                       [](void *owner) { delete static_cast<std::string *>(owner); });
+        return true;
+    }
+
+    /**
+     * Looks up several keys at once, result is the same as of GetRef call for each key, but storage could
+     * resolve all of them in a single critical section.
+     *
+     * @param keys to retrive values for, could contain duplicates
+     * @param items output parameter, resized to keys.size(), i-th item is value of i-th key or empty if
+     * there is no such key
+     * @return number of found keys
      */
-    virtual bool Get(const std::string &key, std::string &value) = 0;
+    virtual size_t MultiGet(const std::vector<std::string> &keys, std::vector<ItemRef> &items) {
+        items.clear();
+        items.resize(keys.size());
+        size_t found = 0;
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (GetRef(keys[i], items[i])) {
+                found++;
+            }
+        }
+        return found;
+    }
 };
 
 } // namespace Afina
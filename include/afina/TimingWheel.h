@@ -0,0 +1,253 @@
+#ifndef AFINA_TIMING_WHEEL_H
+#define AFINA_TIMING_WHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Afina {
+
+/**
+ * Intrusive link of the item scheduled in the TimingWheel, item must have one as a member. Links are
+ * initialized with nullptr, which means item isn't scheduled
+ */
+template <typename T> struct TimerHook {
+    T *next = nullptr;
+
+    // Either slot head or next field of the previous item
+    T **pprev = nullptr;
+};
+
+/**
+ * # Hierarchical timing wheel
+ * Schedules items by the deadline kept in the item itself (uint32_t member When), in abstract ticks: seconds,
+ * milliseconds or whatever caller uses. Level 0 has a slot per tick for the next 256 ticks, each next level has
+ * slots 256 times wider. Once time comes to the start of some upper level slot, its items are redistributed into
+ * lower levels (cascaded).
+ *
+ * Add/Remove are O(1). Advance costs O(number of expired items) plus amortized cascading: it never touches items
+ * that are not due yet, and bitmaps of non empty slots let it jump over empty ticks. Items are linked intrusively
+ * through TimerHook member, so wheel itself doesn't allocate anything and takes fixed amount of memory.
+ *
+ * Time wraps around, deadlines must be less than 2^31 ticks ahead of the current time, otherwise they are
+ * considered to be in the past. That is NOT thread safe implementaiton!!
+ */
+template <typename T, TimerHook<T> T::*Hook, uint32_t T::*When> class TimingWheel {
+public:
+    /**
+     * @param now current time, wheel starts counting from it
+     */
+    TimingWheel(uint32_t now) : _now(now), _size(0) { Clear(); }
+
+    // Schedules item at item.*When. Items in the past expire on the next Advance call.
+    // Item must not be scheduled already
+    void Add(T &item) {
+        _Link(item);
+        _size++;
+    }
+
+    // Cancels item, does nothing if item isn't scheduled
+    void Remove(T &item) {
+        if (!Scheduled(item)) {
+            return;
+        }
+        _Unlink(item);
+        _size--;
+    }
+
+    static bool Scheduled(const T &item) { return (item.*Hook).pprev != nullptr; }
+
+    /**
+     * Moves current time up to now and calls expired(T &) for each item which deadline has come. Item is
+     * unscheduled before the call, so callback could free it or schedule again.
+     *
+     * @param limit max number of items to expire, the rest is left for the next call
+     * @return number of expired items
+     */
+    template <typename F>
+    size_t Advance(uint32_t now, F expired, size_t limit = std::numeric_limits<size_t>::max()) {
+        size_t count = 0;
+        for (;;) {
+            T *&slot = _slots[0][_now & kSlotMask];
+            while (slot != nullptr) {
+                if (count == limit) {
+                    return count;
+                }
+                T &item = *slot;
+                Remove(item);
+                count++;
+                expired(item);
+            }
+
+            if (!_Before(_now, now)) {
+                return count;
+            }
+
+            // Nothing happens between now and the next event, jump there
+            uint32_t next = _NextEvent();
+            if (_size == 0 || _Before(now, next)) {
+                _now = now;
+                return count;
+            }
+            _now = next;
+            _Cascade();
+        }
+    }
+
+    /**
+     * Earliest time Advance could expire something, it is exact if some items are due during the next
+     * kSlots ticks, otherwise that is the next cascading time
+     *
+     * @return false if nothing is scheduled
+     */
+    bool NextExpiration(uint32_t &when) const {
+        if (_size == 0) {
+            return false;
+        }
+        when = _slots[0][_now & kSlotMask] != nullptr ? _now : _NextEvent();
+        return true;
+    }
+
+    // Forgets all items without touching them
+    void Clear() {
+        for (size_t level = 0; level < kLevels; level++) {
+            for (size_t i = 0; i < kSlots; i++) {
+                _slots[level][i] = nullptr;
+            }
+            for (size_t i = 0; i < kWords; i++) {
+                _used[level][i] = 0;
+            }
+        }
+        _size = 0;
+    }
+
+    inline uint32_t now() const { return _now; }
+    inline size_t size() const { return _size; }
+    inline bool empty() const { return _size == 0; }
+
+private:
+    static const size_t kLevels = 4;
+    static const size_t kSlotBits = 8;
+    static const size_t kSlots = 1 << kSlotBits;
+    static const uint32_t kSlotMask = kSlots - 1;
+    static const size_t kWords = kSlots / 64;
+
+    // a < b taking wrap around into account
+    static inline bool _Before(uint32_t a, uint32_t b) { return int32_t(b - a) > 0; }
+
+    // Links item into the slot according to its deadline
+    void _Link(T &item) {
+        uint32_t when = item.*When;
+        uint32_t delta = _Before(_now, when) ? when - _now : 0;
+        if (delta == 0) {
+            when = _now;
+        }
+
+        size_t level = 0;
+        while (level + 1 < kLevels && delta >= (uint32_t(1) << (kSlotBits * (level + 1)))) {
+            level++;
+        }
+
+        size_t index = (when >> (kSlotBits * level)) & kSlotMask;
+        _used[level][index / 64] |= uint64_t(1) << (index % 64);
+
+        T *&slot = _slots[level][index];
+        TimerHook<T> &hook = item.*Hook;
+        hook.next = slot;
+        hook.pprev = &slot;
+        if (slot != nullptr) {
+            (slot->*Hook).pprev = &hook.next;
+        }
+        slot = &item;
+    }
+
+    void _Unlink(T &item) {
+        TimerHook<T> &hook = item.*Hook;
+        *hook.pprev = hook.next;
+        if (hook.next != nullptr) {
+            (hook.next->*Hook).pprev = hook.pprev;
+        } else {
+            // Item was the last one, if it was the first one as well then slot is empty now
+            uintptr_t first = reinterpret_cast<uintptr_t>(&_slots[0][0]);
+            uintptr_t prev = reinterpret_cast<uintptr_t>(hook.pprev);
+            if (prev >= first && prev < first + sizeof(_slots)) {
+                size_t n = (prev - first) / sizeof(T *);
+                _used[n / kSlots][(n % kSlots) / 64] &= ~(uint64_t(1) << (n % 64));
+            }
+        }
+        hook.next = nullptr;
+        hook.pprev = nullptr;
+    }
+
+    // Redistributes items of upper level slots starting at _now into lower levels
+    void _Cascade() {
+        for (size_t level = 1; level < kLevels; level++) {
+            if (((_now >> (kSlotBits * (level - 1))) & kSlotMask) != 0) {
+                return;
+            }
+
+            size_t index = (_now >> (kSlotBits * level)) & kSlotMask;
+            T *item = _slots[level][index];
+            _slots[level][index] = nullptr;
+            _used[level][index / 64] &= ~(uint64_t(1) << (index % 64));
+            while (item != nullptr) {
+                T *next = (item->*Hook).next;
+                _Link(*item);
+                item = next;
+            }
+        }
+    }
+
+    // First non empty slot of the level with index in [from, kSlots), kSlots if none
+    size_t _NextUsed(size_t level, size_t from) const {
+        for (size_t word = from / 64; word < kWords; word++) {
+            uint64_t bits = _used[level][word];
+            if (word == from / 64) {
+                bits &= ~uint64_t(0) << (from % 64);
+            }
+            if (bits != 0) {
+                return word * 64 + __builtin_ctzll(bits);
+            }
+        }
+        return kSlots;
+    }
+
+    // Earliest time after _now when something has to be done: either level 0 slot expires or upper level
+    // slot gets cascaded. Must be called only if some items are scheduled
+    uint32_t _NextEvent() const {
+        for (size_t level = 0; level < kLevels; level++) {
+            size_t shift = kSlotBits * level;
+            uint64_t block = uint64_t(1) << (shift + kSlotBits);
+            uint64_t base = _now & ~(block - 1);
+
+            // Non empty slot later in the current block of the level
+            size_t next = _NextUsed(level, ((_now >> shift) & kSlotMask) + 1);
+            if (next < kSlots) {
+                return base + (uint64_t(next) << shift);
+            }
+
+            // Slots before the current one belong to the next block, that starts at the upper level boundary
+            if (_NextUsed(level, 0) < kSlots) {
+                return base + block;
+            }
+        }
+        return _now + 1;
+    }
+
+    // All items with deadline before or equal to it have been expired, except for ones left in the
+    // current slot due to limit
+    uint32_t _now;
+
+    // Number of scheduled items
+    size_t _size;
+
+    // Heads of item lists
+    T *_slots[kLevels][kSlots];
+
+    // Bitmaps of non empty slots
+    uint64_t _used[kLevels][kWords];
+};
+
+} // namespace Afina
+
+#endif // AFINA_TIMING_WHEEL_H
@@ -1,10 +1,117 @@
 #ifndef AFINA_CONCURRENCY_CORE_LOCAL_H
 #define AFINA_CONCURRENCY_CORE_LOCAL_H
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+
+#include <sched.h>
+#include <unistd.h>
+
+// glibc registers rseq area for every thread since 2.35, kernel keeps the current CPU number there
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 35))
+#include <sys/rseq.h>
+#define AFINA_HAVE_RSEQ 1
+#endif
+
 namespace Afina {
 namespace Concurrency {
 
-template <typename T> class CoreLocal {};
+// Cache line size, slots of different CPUs never share one
+const size_t kCacheLine = 64;
+
+/**
+ * Number of CPU the calling thread runs on. Thread could be moved to another CPU right after the call, so
+ * result is a hint only. Reads it from rseq area if kernel and libc support it, otherwise asks kernel
+ */
+inline unsigned CurrentCpu() {
+#ifdef AFINA_HAVE_RSEQ
+    if (__rseq_size > 0) {
+        const volatile struct rseq *area = reinterpret_cast<const struct rseq *>(
+            static_cast<const char *>(__builtin_thread_pointer()) + __rseq_offset);
+        int32_t cpu = area->cpu_id;
+        if (cpu >= 0) {
+            return cpu;
+        }
+    }
+#endif
+    int cpu = sched_getcpu();
+    return cpu < 0 ? 0 : cpu;
+}
+
+/**
+ * # Per CPU instance of the value
+ * Each configured CPU has its own value in a separate cache line, so threads running on different CPUs
+ * never write into the same line. Unlike ThreadLocal number of values doesn't grow with number of threads,
+ * but several threads could use the same value at once: one could be preempted in the middle of an update
+ * and another one scheduled to the same CPU. So T must be safe for concurrent use, e.g. relaxed atomics,
+ * which stay cheap since the line is almost never contended.
+ *
+ * Readers combine values of all CPUs with Fold
+ */
+template <typename T> class CoreLocal {
+public:
+    CoreLocal() : _size(_CpuCount()), _slots(nullptr) {
+        void *p = nullptr;
+        if (posix_memalign(&p, kCacheLine, _size * sizeof(slot)) != 0) {
+            throw std::bad_alloc();
+        }
+        _slots = static_cast<slot *>(p);
+        for (size_t i = 0; i < _size; i++) {
+            new (&_slots[i]) slot();
+        }
+    }
+
+    CoreLocal(const CoreLocal &) = delete;
+    CoreLocal &operator=(const CoreLocal &) = delete;
+
+    ~CoreLocal() {
+        for (size_t i = 0; i < _size; i++) {
+            _slots[i].~slot();
+        }
+        free(_slots);
+    }
+
+    // Value of the CPU calling thread runs on
+    inline T &get() { return _slots[CurrentCpu() % _size].value; }
+
+    inline T &operator*() { return get(); }
+    inline T *operator->() { return &get(); }
+
+    // Value of the given CPU
+    inline T &operator[](size_t cpu) { return _slots[cpu].value; }
+
+    // Number of values
+    inline size_t size() const { return _size; }
+
+    /**
+     * Combines values of all CPUs: result = f(... f(f(init, value0), value1) ..., valueN). Values keep
+     * changing meanwhile, so result isn't a snapshot
+     */
+    template <typename R, typename F> R Fold(R init, F f) const {
+        for (size_t i = 0; i < _size; i++) {
+            const T &value = _slots[i].value;
+            init = f(init, value);
+        }
+        return init;
+    }
+
+private:
+    struct alignas(kCacheLine) slot {
+        T value;
+    };
+
+    static size_t _CpuCount() {
+        long n = sysconf(_SC_NPROCESSORS_CONF);
+        return n > 0 ? n : 1;
+    }
+
+    const size_t _size;
+
+    slot *_slots;
+};
 
 } // namespace Concurrency
 } // namespace Afina
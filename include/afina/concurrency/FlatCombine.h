@@ -1,10 +1,174 @@
 #ifndef AFINA_CONCURRENCY_FLAT_COMBINE_H
 #define AFINA_CONCURRENCY_FLAT_COMBINE_H
 
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include <afina/concurrency/CoreLocal.h>
+#include <afina/concurrency/ThreadLocal.h>
+
 namespace Afina {
 namespace Concurrency {
 
-template <typename Op> class FlatCombine {};
+/**
+ * # Flat combining executor
+ * Runs operations on a data structure that is not thread safe itself. Instead of taking a lock for each
+ * operation, thread publishes it in its own slot. Whoever grabs the combiner lock applies operations from all
+ * slots one after another, so data structure stays in its cache and lock changes hands once per batch, not
+ * once per operation. Other threads spin on their slots until the result is ready.
+ *
+ * Op is any type callable as op(), it is run by the combiner thread. Exception thrown by op is rethrown to the
+ * thread which executes it
+ */
+template <typename Op> class FlatCombine {
+public:
+    FlatCombine() : _combining(false), _handles([this] { return new handle(_Acquire()); }) {}
+
+    FlatCombine(const FlatCombine &) = delete;
+    FlatCombine &operator=(const FlatCombine &) = delete;
+
+    /**
+     * Runs op exclusively with all other operations and waits until it is done
+     */
+    void Execute(Op &op) {
+        record &r = *_handles->slot;
+        r.op.store(&op, std::memory_order_release);
+        for (;;) {
+            if (!_combining.exchange(true, std::memory_order_acquire)) {
+                _Combine();
+                _combining.store(false, std::memory_order_release);
+                break;
+            }
+
+            // Somebody else is combining, most likely it'll pick our operation up soon
+            for (size_t i = 0; i < kSpins && r.op.load(std::memory_order_acquire) != nullptr; i++) {
+                _Pause();
+            }
+            if (r.op.load(std::memory_order_acquire) == nullptr) {
+                break;
+            }
+            std::this_thread::yield();
+        }
+
+        if (r.error) {
+            std::exception_ptr error;
+            std::swap(error, r.error);
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    // Publication slot of one thread, each one takes its own cache line
+    struct alignas(kCacheLine) record {
+        record() : op(nullptr), owned(true), next(nullptr) {}
+
+        // Operation waiting for combiner, reset once it is done
+        std::atomic<Op *> op;
+
+        // Exception thrown by the last operation
+        std::exception_ptr error;
+
+        // Record belongs to a live thread, otherwise it could be given to a new one
+        std::atomic<bool> owned;
+
+        // Next record in the list, never changes once record is published
+        record *next;
+    };
+
+    // Thread's reference to its record, record gets free once thread exits
+    struct handle {
+        handle(record *slot) : slot(slot) {}
+        ~handle() { slot->owned.store(false, std::memory_order_release); }
+
+        record *slot;
+    };
+
+    // Owns all records, records are only added until executor is destroyed
+    struct record_list {
+        record_list() : head(nullptr) {}
+        ~record_list() {
+            record *r = head.load(std::memory_order_relaxed);
+            while (r != nullptr) {
+                record *next = r->next;
+                r->~record();
+                free(r);
+                r = next;
+            }
+        }
+
+        std::atomic<record *> head;
+    };
+
+    // Max number of passes over records per combining
+    static const size_t kPasses = 4;
+
+    // Number of checks of the own record before giving CPU away
+    static const size_t kSpins = 128;
+
+    // Finds free record or creates new one
+    record *_Acquire() {
+        std::lock_guard<std::mutex> lock(_registry);
+        for (record *r = _records.head.load(std::memory_order_relaxed); r != nullptr; r = r->next) {
+            if (!r->owned.load(std::memory_order_acquire)) {
+                r->owned.store(true, std::memory_order_relaxed);
+                return r;
+            }
+        }
+
+        void *p = nullptr;
+        if (posix_memalign(&p, kCacheLine, sizeof(record)) != 0) {
+            throw std::bad_alloc();
+        }
+        record *r = new (p) record();
+        r->next = _records.head.load(std::memory_order_relaxed);
+        _records.head.store(r, std::memory_order_release);
+        return r;
+    }
+
+    // Applies pending operations of all threads, called under combiner lock
+    void _Combine() {
+        for (size_t pass = 0; pass < kPasses; pass++) {
+            bool found = false;
+            for (record *r = _records.head.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+                Op *op = r->op.load(std::memory_order_acquire);
+                if (op == nullptr) {
+                    continue;
+                }
+                found = true;
+                try {
+                    (*op)();
+                } catch (...) {
+                    r->error = std::current_exception();
+                }
+                r->op.store(nullptr, std::memory_order_release);
+            }
+            if (!found) {
+                break;
+            }
+        }
+    }
+
+    static inline void _Pause() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+
+    record_list _records;
+
+    // Guards record allocation and reuse
+    std::mutex _registry;
+
+    // Combiner lock
+    std::atomic<bool> _combining;
+
+    // Declared after _records, so that all handles are gone before records are freed
+    ThreadLocal<handle> _handles;
+};
 
 } // namespace Concurrency
 } // namespace Afina
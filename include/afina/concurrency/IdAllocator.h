@@ -0,0 +1,52 @@
+#ifndef AFINA_CONCURRENCY_ID_ALLOCATOR_H
+#define AFINA_CONCURRENCY_ID_ALLOCATOR_H
+
+#include <atomic>
+#include <cstdint>
+
+#include <afina/concurrency/ThreadLocal.h>
+
+namespace Afina {
+namespace Concurrency {
+
+/**
+ * # Source of unique ids
+ * Each thread takes a block of ids from the shared counter at once and then hands them out without touching
+ * shared memory, so the counter cache line moves between cores once per block instead of once per id.
+ *
+ * Ids given to one thread are increasing, ids of different threads interleave by blocks. Ids left in the block
+ * of exited thread are never given out
+ */
+class IdAllocator {
+public:
+    // Ids start from first, block takes batch of them
+    explicit IdAllocator(uint64_t batch = 1024, uint64_t first = 1) : _batch(batch), _next(first) {}
+
+    uint64_t Next() {
+        block &b = _blocks.get();
+        if (b.next == b.end) {
+            b.next = _next.fetch_add(_batch, std::memory_order_relaxed);
+            b.end = b.next + _batch;
+        }
+        return b.next++;
+    }
+
+private:
+    // Ids [next, end) are owned by the thread
+    struct block {
+        uint64_t next = 0;
+        uint64_t end = 0;
+    };
+
+    const uint64_t _batch;
+
+    // First id of the next block
+    std::atomic<uint64_t> _next;
+
+    ThreadLocal<block> _blocks;
+};
+
+} // namespace Concurrency
+} // namespace Afina
+
+#endif // AFINA_CONCURRENCY_ID_ALLOCATOR_H
@@ -1,10 +1,109 @@
 #ifndef AFINA_CONCURRENCY_THREAD_LOCAL_H
 #define AFINA_CONCURRENCY_THREAD_LOCAL_H
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+
+#include <pthread.h>
+
 namespace Afina {
 namespace Concurrency {
 
-template <typename T> class ThreadLocal {};
+/**
+ * # Per thread instance of the value
+ * Unlike thread_local variables each object has its own set of values, so it could be a class member. Value
+ * of the calling thread is created by the factory on first access and lives until thread exits or the object
+ * is destroyed, whichever comes first.
+ *
+ * Object must outlive all threads accessing it, or at least their accesses
+ */
+template <typename T> class ThreadLocal {
+public:
+    ThreadLocal() : ThreadLocal([] { return new T(); }) {}
+
+    explicit ThreadLocal(std::function<T *()> factory) : _factory(std::move(factory)) {
+        if (pthread_key_create(&_key, &ThreadLocal::_Destroy) != 0) {
+            throw std::runtime_error("Failed to create thread key");
+        }
+    }
+
+    ThreadLocal(const ThreadLocal &) = delete;
+    ThreadLocal &operator=(const ThreadLocal &) = delete;
+
+    ~ThreadLocal() {
+        pthread_key_delete(_key);
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (slot *s : _slots) {
+            delete s;
+        }
+    }
+
+    // Value of the calling thread
+    T &get() {
+        void *p = pthread_getspecific(_key);
+        if (p == nullptr) {
+            p = _Create();
+        }
+        return *static_cast<slot *>(p)->value;
+    }
+
+    inline T &operator*() { return get(); }
+    inline T *operator->() { return &get(); }
+
+    /**
+     * Calls f for the value of each live thread. Threads keep working with their values meanwhile, so f must
+     * only do what is safe to do concurrently with them, e.g. read atomics
+     */
+    template <typename F> void ForEach(F f) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (slot *s : _slots) {
+            f(*s->value);
+        }
+    }
+
+private:
+    struct slot {
+        ThreadLocal *owner;
+        std::unique_ptr<T> value;
+    };
+
+    slot *_Create() {
+        std::unique_ptr<slot> s(new slot{this, std::unique_ptr<T>(_factory())});
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _slots.insert(s.get());
+        }
+        if (pthread_setspecific(_key, s.get()) != 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _slots.erase(s.get());
+            throw std::runtime_error("Failed to set thread value");
+        }
+        return s.release();
+    }
+
+    // Called on thread exit for its value
+    static void _Destroy(void *p) {
+        slot *s = static_cast<slot *>(p);
+        {
+            std::lock_guard<std::mutex> lock(s->owner->_mutex);
+            s->owner->_slots.erase(s);
+        }
+        delete s;
+    }
+
+    std::function<T *()> _factory;
+
+    pthread_key_t _key;
+
+    // Guards _slots
+    std::mutex _mutex;
+
+    // Values of all live threads
+    std::unordered_set<slot *> _slots;
+};
 
 } // namespace Concurrency
 } // namespace Afina
@@ -9,6 +9,8 @@ class Storage;
 
 namespace Execute {
 
+class Response;
+
 /**
  *
  *
@@ -19,6 +21,12 @@ public:
     virtual ~Command() {}
 
     virtual void Execute(Storage &storage, const std::string &args, std::string &out) = 0;
+
+    /**
+     * Same as above, but appends result to the response, so that command could put storage values there
+     * without copying, see Response. Default implementation appends result of the string version
+     */
+    virtual void Execute(Storage &storage, const std::string &args, Response &out);
 };
 
 } // namespace Execute
@@ -26,6 +26,9 @@ namespace Execute {
  * Where <key> is the key for the value, <bytes> is the number of bytes in the
  * value and <data> is the value text
  *
+ * "gets" version of the command adds version of the item after <bytes>, client
+ * passes it to "cas" command later, see Cas
+ *
  * If some of the keys appearing in a retrieval request are not sent back
  * by the server in the item list this means that the server does not
  * hold items with such keys (because they were never stored, or stored
@@ -34,15 +37,22 @@ namespace Execute {
  */
 class Get : public Command {
 public:
-    Get(const std::vector<std::string> &keys) : _keys(keys) {}
+    Get(const std::vector<std::string> &keys, bool with_cas = false) : _keys(keys), _with_cas(with_cas) {}
     ~Get() {}
 
     inline const std::vector<std::string> &keys() const { return _keys; }
+    inline bool with_cas() const { return _with_cas; }
 
     void Execute(Storage &storage, const std::string &args, std::string &out) override;
 
+    // Values are appended as pinned storage items, without copying
+    void Execute(Storage &storage, const std::string &args, Response &out) override;
+
 private:
     std::vector<std::string> _keys;
+
+    // Command is "gets"
+    bool _with_cas;
 };
 
 } // namespace Execute
@@ -22,6 +22,13 @@ public:
     inline const uint32_t flags() const { return _flags; }
     inline const int32_t expire() const { return _expire; }
 
+    /**
+     * Converts memcached expiration time into unix time the item expires at, as Storage expects it.
+     * Zero means item never expires, negative value means item is expired immediately. Values up to 30 days
+     * are relative to the current time, larger ones are absolute unix time
+     */
+    uint32_t expire_at() const;
+
 protected:
     const std::string _key;
     const uint32_t _flags;
@@ -0,0 +1,75 @@
+#ifndef AFINA_EXECUTE_RESPONSE_H
+#define AFINA_EXECUTE_RESPONSE_H
+
+#include <cstddef>
+#include <deque>
+#include <string>
+
+#include <sys/uio.h>
+
+#include <afina/ItemRef.h>
+
+namespace Afina {
+namespace Execute {
+
+/**
+ * # Queue of bytes to be sent to the client
+ * Consists of chunks, each one is either text owned by the response or item value pinned in the storage, so
+ * values are written into the socket right from the storage memory without copying. Adjacent text pieces are
+ * merged into one chunk.
+ */
+class Response {
+public:
+    Response() : _pos(0), _size(0) {}
+
+    // Appends copy of the text
+    void Append(const char *data, size_t size);
+    void Append(const std::string &text) { Append(text.data(), text.size()); }
+
+    // Appends item value without copying, item is released once it is consumed
+    void Append(ItemRef item);
+
+    /**
+     * Fills iov with pointers to the pending bytes, starting from the first not consumed one
+     *
+     * @return number of filled entries, at most iovcnt
+     */
+    size_t Prepare(struct iovec *iov, size_t iovcnt) const;
+
+    // Drops first bytes of the response, e.g. once they are written into socket
+    void Consume(size_t bytes);
+
+    // Copies pending bytes into the string
+    std::string ToString() const;
+
+    void Clear();
+
+    inline bool empty() const { return _chunks.empty(); }
+
+    // Number of pending bytes
+    inline size_t size() const { return _size; }
+
+private:
+    struct chunk {
+        chunk(const char *data, size_t size) : text(data, size) {}
+        chunk(ItemRef &&item) : item(std::move(item)) {}
+
+        inline const char *data() const { return item.empty() ? text.data() : item.data(); }
+        inline size_t size() const { return item.empty() ? text.size() : item.size(); }
+
+        std::string text;
+        ItemRef item;
+    };
+
+    std::deque<chunk> _chunks;
+
+    // Number of bytes of the first chunk already consumed
+    size_t _pos;
+
+    size_t _size;
+};
+
+} // namespace Execute
+} // namespace Afina
+
+#endif // AFINA_EXECUTE_RESPONSE_H
@@ -12,7 +12,7 @@ void Add::Execute(Storage &storage, const std::string &args, std::string &out) {
     // KOCTblLb: network will append '\r\n' to args, executer will delete them
     std::string args_mod = args.substr(0, args.size() - 2);
     std::cout << "Add(" << _key << ")" << args_mod << std::endl;
-    out = storage.PutIfAbsent(_key, args_mod) ? "STORED" : "NOT_STORED";
+    out = storage.PutIfAbsent(_key, args_mod, expire_at(), _flags) ? "STORED" : "NOT_STORED";
 }
 
 } // namespace Execute
@@ -11,13 +11,8 @@ void Append::Execute(Storage &storage, const std::string &args, std::string &out
     // KOCTblLb: network will append '\r\n' to args, executer will delete them
     std::string args_mod = args.substr(0, args.size() - 2);
     std::cout << "Append(" << _key << ")" << args_mod << std::endl;
-    std::string value;
-    if (!storage.Get(_key, value)) {
-        out.assign("NOT_STORED");
-        return;
-    }
-    storage.Put(_key, value + args_mod);
-    out.assign("STORED");
+    // memcached ignores flags and expiration time of append, item keeps its own
+    out.assign(storage.Append(_key, args_mod) ? "STORED" : "NOT_STORED");
 }
 
 } // namespace Execute
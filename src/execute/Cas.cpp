@@ -0,0 +1,32 @@
+#include <afina/Storage.h>
+#include <afina/execute/Cas.h>
+
+#include <iostream>
+
+namespace Afina {
+namespace Execute {
+
+// memcached protocol: "cas" is a check and set operation which means "store this data but
+// only if no one else has updated since I last fetched it."
+void Cas::Execute(Storage &storage, const std::string &args, std::string &out) {
+    // KOCTblLb: network will append '\r\n' to args, executer will delete them
+    std::string args_mod = args.substr(0, args.size() - 2);
+    std::cout << "Cas(" << _key << ", " << _cas << "): " << args_mod << std::endl;
+    switch (storage.Cas(_key, args_mod, _cas, expire_at(), _flags)) {
+    case Storage::CasResult::kStored:
+        out = "STORED";
+        break;
+    case Storage::CasResult::kNotStored:
+        out = "NOT_STORED";
+        break;
+    case Storage::CasResult::kExists:
+        out = "EXISTS";
+        break;
+    case Storage::CasResult::kNotFound:
+        out = "NOT_FOUND";
+        break;
+    }
+}
+
+} // namespace Execute
+} // namespace Afina
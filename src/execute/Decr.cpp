@@ -0,0 +1,22 @@
+#include <afina/Storage.h>
+#include <afina/execute/Decr.h>
+
+#include <iostream>
+#include <stdexcept>
+
+namespace Afina {
+namespace Execute {
+
+// memcached protocol: "decr" means "decrement numeric value of an existing key in place".
+void Decr::Execute(Storage &storage, const std::string &args, std::string &out) {
+    std::cout << "Decr(" << _key << ", " << _delta << ")" << std::endl;
+    uint64_t result;
+    try {
+        out = storage.Decr(_key, _delta, result) ? std::to_string(result) : "NOT_FOUND";
+    } catch (std::invalid_argument &ex) {
+        out = std::string("CLIENT_ERROR ") + ex.what();
+    }
+}
+
+} // namespace Execute
+} // namespace Afina
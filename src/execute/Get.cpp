@@ -1,5 +1,6 @@
 #include <afina/Storage.h>
 #include <afina/execute/Get.h>
+#include <afina/execute/Response.h>
 
 #include <iostream>
 #include <iterator>
@@ -12,7 +13,7 @@ namespace Execute {
 
 Each item sent by the server looks like this:
 
-VALUE <key> <flags> <bytes>\r\n
+VALUE <key> <flags> <bytes> [<cas unique>]\r\n
 <data block>\r\n
 
 After all the items have been transmitted, the server sends the string
@@ -22,22 +23,34 @@ to indicate the end of response.
 */
 
 void Get::Execute(Storage &storage, const std::string &args, std::string &out) {
+    Response response;
+    Execute(storage, args, response);
+    out = response.ToString();
+}
+
+void Get::Execute(Storage &storage, const std::string &args, Response &out) {
     std::stringstream keyStream;
     copy(_keys.begin(), _keys.end(), std::ostream_iterator<std::string>(keyStream, " "));
     std::cout << "Get(" << keyStream.str() << ")" << std::endl;
 
-    std::stringstream outStream;
-
-    std::string value;
-    for (auto &key : _keys) {
-        if (!storage.Get(key, value))
+    // All keys are resolved at once, so storage could take its locks once per request, not once per key
+    std::vector<ItemRef> items;
+    storage.MultiGet(_keys, items);
+    for (size_t i = 0; i < _keys.size(); i++) {
+        ItemRef &item = items[i];
+        if (item.empty())
             continue;
-        outStream << "VALUE " << key << " 0 " << value.size() << "\r\n";
-        outStream << value << "\r\n";
+        std::string header =
+            "VALUE " + _keys[i] + " " + std::to_string(item.flags()) + " " + std::to_string(item.size());
+        if (_with_cas) {
+            header += " " + std::to_string(item.cas());
+        }
+        header += "\r\n";
+        out.Append(header);
+        out.Append(std::move(item));
+        out.Append("\r\n", 2);
     }
-    outStream << "END"; // networking layer should add the last \r\n
-
-    out = outStream.str();
+    out.Append("END", 3); // networking layer should add the last \r\n
 }
 
 } // namespace Execute
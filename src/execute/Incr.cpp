@@ -0,0 +1,22 @@
+#include <afina/Storage.h>
+#include <afina/execute/Incr.h>
+
+#include <iostream>
+#include <stdexcept>
+
+namespace Afina {
+namespace Execute {
+
+// memcached protocol: "incr" means "increment numeric value of an existing key in place".
+void Incr::Execute(Storage &storage, const std::string &args, std::string &out) {
+    std::cout << "Incr(" << _key << ", " << _delta << ")" << std::endl;
+    uint64_t result;
+    try {
+        out = storage.Incr(_key, _delta, result) ? std::to_string(result) : "NOT_FOUND";
+    } catch (std::invalid_argument &ex) {
+        out = std::string("CLIENT_ERROR ") + ex.what();
+    }
+}
+
+} // namespace Execute
+} // namespace Afina
@@ -0,0 +1,25 @@
+#include <afina/execute/InsertCommand.h>
+
+#include <ctime>
+
+namespace Afina {
+namespace Execute {
+
+// Larger expiration times are absolute
+static const int32_t kMaxRelativeExpire = 60 * 60 * 24 * 30;
+
+// See InsertCommand.h
+uint32_t InsertCommand::expire_at() const {
+    if (_expire == 0) {
+        return 0;
+    } else if (_expire < 0) {
+        // Any moment in the past
+        return 1;
+    } else if (_expire <= kMaxRelativeExpire) {
+        return std::time(nullptr) + _expire;
+    }
+    return _expire;
+}
+
+} // namespace Execute
+} // namespace Afina
@@ -0,0 +1,19 @@
+#include <afina/Storage.h>
+#include <afina/execute/Prepend.h>
+
+#include <iostream>
+
+namespace Afina {
+namespace Execute {
+
+// memcached protocol: "prepend" means "add this data to an existing key before existing data".
+void Prepend::Execute(Storage &storage, const std::string &args, std::string &out) {
+    // KOCTblLb: network will append '\r\n' to args, executer will delete them
+    std::string args_mod = args.substr(0, args.size() - 2);
+    std::cout << "Prepend(" << _key << ")" << args_mod << std::endl;
+    // memcached ignores flags and expiration time of prepend, item keeps its own
+    out.assign(storage.Prepend(_key, args_mod) ? "STORED" : "NOT_STORED");
+}
+
+} // namespace Execute
+} // namespace Afina
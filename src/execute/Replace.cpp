@@ -13,13 +13,7 @@ void Replace::Execute(Storage &storage, const std::string &args, std::string &ou
     // KOCTblLb: network will append '\r\n' to args, executer will delete them
     std::string args_mod = args.substr(0, args.size() - 2);
     std::cout << "Replace(" << _key << "): " << args_mod << std::endl;
-    std::string value;
-    if (storage.Get(_key, value)) {
-        storage.Set(_key, args_mod);
-        out = "STORED";
-    } else {
-        out = "NOT_STORED";
-    }
+    out = storage.Set(_key, args_mod, expire_at(), _flags) ? "STORED" : "NOT_STORED";
 }
 
 } // namespace Execute
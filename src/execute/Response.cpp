@@ -0,0 +1,75 @@
+#include <afina/execute/Response.h>
+
+#include <utility>
+
+namespace Afina {
+namespace Execute {
+
+// See Response.h
+void Response::Append(const char *data, size_t size) {
+    if (size == 0) {
+        return;
+    }
+    if (!_chunks.empty() && _chunks.back().item.empty()) {
+        _chunks.back().text.append(data, size);
+    } else {
+        _chunks.emplace_back(data, size);
+    }
+    _size += size;
+}
+
+// See Response.h
+void Response::Append(ItemRef item) {
+    if (item.size() == 0) {
+        return;
+    }
+    _size += item.size();
+    _chunks.emplace_back(std::move(item));
+}
+
+// See Response.h
+size_t Response::Prepare(struct iovec *iov, size_t iovcnt) const {
+    size_t n = 0;
+    for (auto it = _chunks.begin(); it != _chunks.end() && n < iovcnt; ++it, ++n) {
+        size_t skip = (n == 0 ? _pos : 0);
+        iov[n].iov_base = const_cast<char *>(it->data()) + skip;
+        iov[n].iov_len = it->size() - skip;
+    }
+    return n;
+}
+
+// See Response.h
+void Response::Consume(size_t bytes) {
+    _size -= bytes;
+    while (bytes > 0) {
+        size_t left = _chunks.front().size() - _pos;
+        if (bytes < left) {
+            _pos += bytes;
+            return;
+        }
+        bytes -= left;
+        _chunks.pop_front();
+        _pos = 0;
+    }
+}
+
+// See Response.h
+std::string Response::ToString() const {
+    std::string result;
+    result.reserve(_size);
+    for (size_t i = 0; i < _chunks.size(); i++) {
+        size_t skip = (i == 0 ? _pos : 0);
+        result.append(_chunks[i].data() + skip, _chunks[i].size() - skip);
+    }
+    return result;
+}
+
+// See Response.h
+void Response::Clear() {
+    _chunks.clear();
+    _pos = 0;
+    _size = 0;
+}
+
+} // namespace Execute
+} // namespace Afina
@@ -20,7 +20,11 @@
 #include "network/st_blocking/ServerImpl.h"
 #include "network/st_nonblocking/ServerImpl.h"
 
+#include "storage/FlatCombineLRU.h"
+#include "storage/ShardedLRU.h"
+#include "storage/SimpleClock.h"
 #include "storage/SimpleLRU.h"
+#include "storage/ThreadSafeSimpleClock.h"
 #include "storage/ThreadSafeSimpleLRU.h"
 
 using namespace Afina;
@@ -50,10 +54,59 @@ public:
             storage_type = options["storage"].as<std::string>();
         }
 
+        std::string promotion_type = "always";
+        if (options.count("promotion") > 0) {
+            promotion_type = options["promotion"].as<std::string>();
+        }
+
+        Afina::Backend::SimpleLRU::Promotion promotion;
+        if (promotion_type == "always") {
+            promotion = Afina::Backend::SimpleLRU::Promotion::kAlways;
+        } else if (promotion_type == "interval") {
+            promotion = Afina::Backend::SimpleLRU::Promotion::kInterval;
+        } else if (promotion_type == "mark") {
+            promotion = Afina::Backend::SimpleLRU::Promotion::kMark;
+        } else {
+            throw std::runtime_error("Unknown promotion type");
+        }
+
+        std::chrono::milliseconds promotion_interval{60000}; // default
+        if (options.count("promotion-interval") > 0) {
+            promotion_interval = std::chrono::milliseconds{options["promotion-interval"].as<uint32_t>()};
+        }
+
+        std::string admission_type = "none";
+        if (options.count("admission") > 0) {
+            admission_type = options["admission"].as<std::string>();
+        }
+
+        Afina::Backend::SimpleLRU::Admission admission;
+        if (admission_type == "none") {
+            admission = Afina::Backend::SimpleLRU::Admission::kNone;
+        } else if (admission_type == "tinylfu") {
+            admission = Afina::Backend::SimpleLRU::Admission::kTinyLFU;
+        } else {
+            throw std::runtime_error("Unknown admission type");
+        }
+
         if (storage_type == "st_lru") {
-            storage = std::make_shared<Afina::Backend::SimpleLRU>();
+            storage = std::make_shared<Afina::Backend::SimpleLRU>(1024, promotion, promotion_interval, admission);
         } else if (storage_type == "mt_lru") {
-            storage = std::make_shared<Afina::Backend::ThreadSafeSimplLRU>();
+            storage = std::make_shared<Afina::Backend::ThreadSafeSimplLRU>(1024, promotion, promotion_interval,
+                                                                           admission);
+        } else if (storage_type == "fc_lru") {
+            storage = std::make_shared<Afina::Backend::FlatCombineLRU>(1024, promotion, promotion_interval, admission);
+        } else if (storage_type == "st_clock") {
+            storage = std::make_shared<Afina::Backend::SimpleClock>();
+        } else if (storage_type == "mt_clock") {
+            storage = std::make_shared<Afina::Backend::ThreadSafeSimpleClock>();
+        } else if (storage_type == "sharded_lru") {
+            uint32_t shards = 8; // default
+            if (options.count("shards") > 0) {
+                shards = options["shards"].as<uint32_t>();
+            }
+            storage = std::make_shared<Afina::Backend::ShardedLRU>(1024, shards, promotion, promotion_interval,
+                                                                   admission);
         } else {
             throw std::runtime_error("Unknown storage type");
         }
@@ -157,6 +210,14 @@ int main(int argc, char **argv) {
         // DONE?: use custom cxxopts::value to print options possible values in help message
         // and simplify validation below
         options.add_options()("s,storage", "Type of storage service to use", cxxopts::value<std::string>());
+        options.add_options()("shards", "Number of shards for sharded_lru storage (def=8)",
+                              cxxopts::value<uint32_t>());
+        options.add_options()("promotion", "What LRU storages do on hit: always, interval, mark (def=always)",
+                              cxxopts::value<std::string>());
+        options.add_options()("promotion-interval", "Min time in ms between promotions of an item (def=60000)",
+                              cxxopts::value<uint32_t>());
+        options.add_options()("admission", "Which new items LRU storages admit: none, tinylfu (def=none)",
+                              cxxopts::value<std::string>());
         options.add_options()("n,network", "Type of network service to use", cxxopts::value<std::string>());
         options.add_options()("w,workers", "Max number of workers (def=1)", cxxopts::value<uint32_t>());
         options.add_options()("a,acceptors", "Max number of acceptable connections (def=1)",
@@ -7,13 +7,22 @@ namespace Network {
 namespace MTnonblock {
 
 // See Connection.h
-void Connection::Start() { std::cout << "Start" << std::endl; }
+void Connection::Start() {
+    std::cout << "Start" << std::endl;
+    _is_alive = true;
+}
 
 // See Connection.h
-void Connection::OnError() { std::cout << "OnError" << std::endl; }
+void Connection::OnError() {
+    std::cout << "OnError" << std::endl;
+    _is_alive = false;
+}
 
 // See Connection.h
-void Connection::OnClose() { std::cout << "OnClose" << std::endl; }
+void Connection::OnClose() {
+    std::cout << "OnClose" << std::endl;
+    _is_alive = false;
+}
 
 // See Connection.h
 void Connection::DoRead() { std::cout << "DoRead" << std::endl; }
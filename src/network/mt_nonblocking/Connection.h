@@ -1,22 +1,25 @@
 #ifndef AFINA_NETWORK_MT_NONBLOCKING_CONNECTION_H
 #define AFINA_NETWORK_MT_NONBLOCKING_CONNECTION_H
 
+#include <cstdint>
 #include <cstring>
 
 #include <sys/epoll.h>
 
+#include <afina/TimingWheel.h>
+
 namespace Afina {
 namespace Network {
 namespace MTnonblock {
 
 class Connection {
 public:
-    Connection(int s) : _socket(s) {
+    Connection(int s) : _socket(s), _is_alive(false), _idle_deadline(0) {
         std::memset(&_event, 0, sizeof(struct epoll_event));
         _event.data.ptr = this;
     }
 
-    inline bool isAlive() const { return true; }
+    inline bool isAlive() const { return _is_alive; }
 
     void Start();
 
@@ -29,9 +32,16 @@ protected:
 private:
     friend class Worker;
     friend class ServerImpl;
+    friend class IdleTimers;
 
     int _socket;
     struct epoll_event _event;
+
+    bool _is_alive;
+
+    // Link in the idle timeouts wheel and time connection gets closed at, see IdleTimers
+    TimerHook<Connection> _idle_timer;
+    uint32_t _idle_deadline;
 };
 
 } // namespace MTnonblock
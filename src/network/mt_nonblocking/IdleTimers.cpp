@@ -0,0 +1,55 @@
+#include "IdleTimers.h"
+
+#include <algorithm>
+
+#include <sys/socket.h>
+
+namespace Afina {
+namespace Network {
+namespace MTnonblock {
+
+// See IdleTimers.h
+IdleTimers::IdleTimers(std::chrono::milliseconds timeout)
+    : _timeout(timeout.count()), _started(std::chrono::steady_clock::now()), _wheel(0) {}
+
+// See IdleTimers.h
+void IdleTimers::Touch(Connection &c) {
+    if (_timeout == 0) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(_mutex);
+    _wheel.Remove(c);
+    c._idle_deadline = _Now() + _timeout;
+    _wheel.Add(c);
+}
+
+// See IdleTimers.h
+void IdleTimers::Cancel(Connection &c) {
+    if (_timeout == 0) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(_mutex);
+    _wheel.Remove(c);
+}
+
+// See IdleTimers.h
+int IdleTimers::Expire() {
+    if (_timeout == 0) {
+        return -1;
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    uint32_t now = _Now();
+    _wheel.Advance(now, [](Connection &c) { shutdown(c._socket, SHUT_RDWR); });
+
+    // Connection scheduled by somebody else later can't expire earlier than in timeout
+    uint32_t next;
+    if (!_wheel.NextExpiration(next)) {
+        return _timeout;
+    }
+    return std::max(int32_t(next - now), 0);
+}
+
+} // namespace MTnonblock
+} // namespace Network
+} // namespace Afina
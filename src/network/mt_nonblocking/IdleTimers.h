@@ -0,0 +1,62 @@
+#ifndef AFINA_NETWORK_MT_NONBLOCKING_IDLE_TIMERS_H
+#define AFINA_NETWORK_MT_NONBLOCKING_IDLE_TIMERS_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include <afina/TimingWheel.h>
+
+#include "Connection.h"
+
+namespace Afina {
+namespace Network {
+namespace MTnonblock {
+
+/**
+ * # Idle timeouts of connections, shared by all workers
+ * Connection is scheduled while it waits in epoll for events and canceled while some worker processes it, so
+ * the connection found expired isn't used by anybody. It isn't closed right away though: its socket gets shut
+ * down, so epoll reports hangup to some worker which closes the connection as usual.
+ */
+class IdleTimers {
+public:
+    /**
+     * @param timeout connections without events for that time are closed, 0 means never
+     */
+    IdleTimers(std::chrono::milliseconds timeout);
+
+    // (Re)schedules connection expiration in timeout from now, must be called before connection is armed in epoll
+    void Touch(Connection &c);
+
+    // Cancels connection expiration, must be called before worker starts processing connection
+    void Cancel(Connection &c);
+
+    /**
+     * Shuts down connections idle for too long
+     *
+     * @return milliseconds until the next call is needed, -1 if timeouts are disabled
+     */
+    int Expire();
+
+private:
+    // Milliseconds since creation
+    inline uint32_t _Now() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _started)
+            .count();
+    }
+
+    const uint32_t _timeout;
+
+    const std::chrono::steady_clock::time_point _started;
+
+    std::mutex _mutex;
+
+    TimingWheel<Connection, &Connection::_idle_timer, &Connection::_idle_deadline> _wheel;
+};
+
+} // namespace MTnonblock
+} // namespace Network
+} // namespace Afina
+
+#endif // AFINA_NETWORK_MT_NONBLOCKING_IDLE_TIMERS_H
@@ -22,6 +22,7 @@
 #include <afina/logging/Service.h>
 
 #include "Connection.h"
+#include "IdleTimers.h"
 #include "Utils.h"
 #include "Worker.h"
 
@@ -36,10 +37,11 @@ ServerImpl::ServerImpl(std::shared_ptr<Afina::Storage> ps, std::shared_ptr<Loggi
 ServerImpl::~ServerImpl() {}
 
 // See Server.h
-void ServerImpl::Start(uint16_t port, uint32_t n_acceptors, uint32_t n_workers,
-                       std::chrono::microseconds = std::chrono::microseconds{5000000}) {
+void ServerImpl::Start(uint16_t port, uint32_t n_acceptors, uint32_t n_workers, std::chrono::microseconds timeout) {
     _logger = pLogging->select("network");
     _logger->info("Start network service");
+    _timeout = timeout;
+    _idle = std::make_shared<IdleTimers>(std::chrono::duration_cast<std::chrono::milliseconds>(timeout));
 
     sigset_t sig_mask;
     sigemptyset(&sig_mask);
@@ -97,7 +99,7 @@ void ServerImpl::Start(uint16_t port, uint32_t n_acceptors, uint32_t n_workers,
 
     _workers.reserve(n_workers);
     for (int i = 0; i < n_workers; i++) {
-        _workers.emplace_back(pStorage, pLogging);
+        _workers.emplace_back(pStorage, pLogging, _idle);
         _workers.back().Start(_data_epoll_fd);
     }
 
@@ -203,8 +205,11 @@ void ServerImpl::OnRun() {
                 pc->Start();
                 if (pc->isAlive()) {
                     pc->_event.events |= EPOLLONESHOT;
+                    _idle->Touch(*pc);
                     if (epoll_ctl(_data_epoll_fd, EPOLL_CTL_ADD, pc->_socket, &pc->_event)) {
+                        _idle->Cancel(*pc);
                         pc->OnError();
+                        close(pc->_socket);
                         delete pc;
                     }
                 }
@@ -17,6 +17,9 @@ namespace MTnonblock {
 // Forward declaration, see Worker.h
 class Worker;
 
+// Forward declaration, see IdleTimers.h
+class IdleTimers;
+
 /**
  * # Network resource manager implementation
  * Epoll based server
@@ -63,6 +66,9 @@ private:
 
     // threads serving read/write requests
     std::vector<Worker> _workers;
+
+    // Idle timeouts of connections, shared by workers and acceptors
+    std::shared_ptr<IdleTimers> _idle;
 };
 
 } // namespace MTnonblock
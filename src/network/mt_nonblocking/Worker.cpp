@@ -5,6 +5,7 @@
 #include <iostream>
 
 #include <netdb.h>
+#include <unistd.h>
 #include <sys/epoll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -14,6 +15,7 @@
 #include <afina/logging/Service.h>
 
 #include "Connection.h"
+#include "IdleTimers.h"
 #include "Utils.h"
 
 namespace Afina {
@@ -21,8 +23,9 @@ namespace Network {
 namespace MTnonblock {
 
 // See Worker.h
-Worker::Worker(std::shared_ptr<Afina::Storage> ps, std::shared_ptr<Afina::Logging::Service> pl)
-    : _pStorage(ps), _pLogging(pl), isRunning(false), _epoll_fd(-1) {
+Worker::Worker(std::shared_ptr<Afina::Storage> ps, std::shared_ptr<Afina::Logging::Service> pl,
+               std::shared_ptr<IdleTimers> idle)
+    : _pStorage(ps), _pLogging(pl), _idle(idle), isRunning(false), _epoll_fd(-1) {
     // TODO: implementation here
 }
 
@@ -39,6 +42,7 @@ Worker &Worker::operator=(Worker &&other) {
     _pStorage = std::move(other._pStorage);
     _pLogging = std::move(other._pLogging);
     _logger = std::move(other._logger);
+    _idle = std::move(other._idle);
     _thread = std::move(other._thread);
     _epoll_fd = other._epoll_fd;
 
@@ -74,9 +78,10 @@ void Worker::OnRun() {
     //
     // Do not forget to use EPOLLEXCLUSIVE flag when register socket
     // for events to avoid thundering herd type behavior.
-    int timeout = -1;
     std::array<struct epoll_event, 64> mod_list;
     while (isRunning) {
+        // Close idle connections and sleep until the next one could expire
+        int timeout = _idle->Expire();
         int nmod = epoll_wait(_epoll_fd, &mod_list[0], mod_list.size(), timeout);
         _logger->debug("Worker wokeup: {} events", nmod);
 
@@ -92,6 +97,7 @@ void Worker::OnRun() {
 
             // Some connection gets new data
             Connection *pconn = static_cast<Connection *>(current_event.data.ptr);
+            _idle->Cancel(*pconn);
             if ((current_event.events & EPOLLERR) || (current_event.events & EPOLLHUP)) {
                 pconn->OnError();
             } else if (current_event.events & EPOLLRDHUP) {
@@ -109,8 +115,11 @@ void Worker::OnRun() {
             // Rearm connection
             if (pconn->isAlive()) {
                 pconn->_event.events |= EPOLLONESHOT;
+                _idle->Touch(*pconn);
                 if (epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, pconn->_socket, &pconn->_event)) {
+                    _idle->Cancel(*pconn);
                     pconn->OnError();
+                    close(pconn->_socket);
                     delete pconn;
                 }
             }
@@ -119,10 +128,10 @@ void Worker::OnRun() {
                 if (epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, pconn->_socket, &pconn->_event)) {
                     std::cerr << "Failed to delete connection!" << std::endl;
                 }
+                close(pconn->_socket);
                 delete pconn;
             }
         }
-        // TODO: Select timeout...
     }
     _logger->warn("Worker stopped");
 }
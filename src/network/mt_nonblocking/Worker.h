@@ -20,6 +20,9 @@ class Service;
 namespace Network {
 namespace MTnonblock {
 
+// Forward declaration, see IdleTimers.h
+class IdleTimers;
+
 /**
  * # Thread running epoll
  * On Start spaws background thread that is doing epoll on the given server
@@ -27,7 +30,8 @@ namespace MTnonblock {
  */
 class Worker {
 public:
-    Worker(std::shared_ptr<Afina::Storage> ps, std::shared_ptr<Afina::Logging::Service> pl);
+    Worker(std::shared_ptr<Afina::Storage> ps, std::shared_ptr<Afina::Logging::Service> pl,
+           std::shared_ptr<IdleTimers> idle);
     ~Worker();
 
     Worker(Worker &&);
@@ -73,6 +77,9 @@ private:
     // Logger to be used
     std::shared_ptr<spdlog::logger> _logger;
 
+    // Idle timeouts of connections, shared by all workers
+    std::shared_ptr<IdleTimers> _idle;
+
     // Flag signals that thread should continue to operate
     std::atomic<bool> isRunning;
 
@@ -17,7 +17,7 @@ void Connection::Start() {
     //    std::cout << "Start" << std::endl;
     _is_alive = true;
     _readed_bytes = -1;
-    _write_pos = 0;
+    _responses.Clear();
     _event.events = READ_EVENT;
 }
 
@@ -104,11 +104,9 @@ void Connection::DoRead() {
             if (_cmd_to_exec && _arg_remains == 0) {
                 _logger->debug("Start command execution");
 
-                std::string result;
                 //                sleep(2); // DEBUG
-                _cmd_to_exec->Execute(*pStorage, _arg_for_cmd, result);
-                result += "\r\n";
-                _responses.emplace_back(std::move(result));
+                _cmd_to_exec->Execute(*pStorage, _arg_for_cmd, _responses);
+                _responses.Append("\r\n", 2);
 
                 // Prepare for the next command
                 _cmd_to_exec.reset();
@@ -122,7 +120,7 @@ void Connection::DoRead() {
         msg += ex.what();
         msg += "\r\n";
         // to pass all itests, replace std::move(msg) by "ERROR"
-        _responses.emplace_back(std::move(msg));
+        _responses.Append(msg);
         OnError();
     }
     if (!_responses.empty()) {
@@ -134,37 +132,19 @@ void Connection::DoRead() {
 void Connection::DoWrite() {
     //    std::cout << "DoWrite" << std::endl;
     assert(!_responses.empty());
-    std::size_t q_size = _responses.size();
-    iovec *q_iov = new iovec[q_size];
+    iovec q_iov[64];
     try {
-        std::size_t i = 0;
-        for (auto it = _responses.begin(); it != _responses.end(); ++it, ++i) {
-            q_iov[i].iov_base = (void *)(it->data());
-            q_iov[i].iov_len = it->size();
-        }
-        q_iov[0].iov_base = static_cast<char *>(q_iov[0].iov_base) + _write_pos;
-        q_iov[0].iov_len -= _write_pos;
-        int _written_bytes = writev(_socket, q_iov, q_size);
-        if (_written_bytes == -1 && errno != EINTR) {
+        std::size_t q_size = _responses.Prepare(q_iov, sizeof(q_iov) / sizeof(q_iov[0]));
+        ssize_t _written_bytes = writev(_socket, q_iov, q_size);
+        if (_written_bytes == -1 && errno != EINTR && errno != EAGAIN) {
             OnError(true);
             throw std::runtime_error(std::string(strerror(errno)));
         } else if (_written_bytes > 0) {
-            for (i = 0; i < q_size; ++i) {
-                int len = q_iov[i].iov_len;
-                if (_written_bytes >= len) {
-                    _written_bytes -= len;
-                    _responses.pop_front();
-                    _write_pos = 0;
-                } else {
-                    break;
-                }
-            }
-            _write_pos += _written_bytes;
+            _responses.Consume(_written_bytes);
         }
     } catch (std::runtime_error &ex) {
         _logger->error("Failed to process connection on descriptor {}: {}", _socket, ex.what());
     }
-    delete[] q_iov;
 
     if (_responses.empty()) {
         _event.events = READ_EVENT;
@@ -2,7 +2,6 @@
 #define AFINA_NETWORK_ST_NONBLOCKING_CONNECTION_H
 
 #include <cstring>
-#include <deque>
 #include <memory>
 #include <string>
 
@@ -13,7 +12,9 @@
 #include <spdlog/logger.h>
 
 #include <afina/Storage.h>
+#include <afina/TimingWheel.h>
 #include <afina/execute/Command.h>
+#include <afina/execute/Response.h>
 #include <afina/logging/Service.h>
 
 #include "protocol/Parser.h"
@@ -75,8 +76,12 @@ private:
     std::string _arg_for_cmd;
     std::unique_ptr<Execute::Command> _cmd_to_exec;
 
-    std::deque<std::string> _responses;
-    std::size_t _write_pos;
+    // Pending output, values in it are pinned in the storage and written right from there
+    Execute::Response _responses;
+
+    // Link in the server idle timeouts wheel and time connection gets closed at, see ServerImpl::_Now()
+    TimerHook<Connection> _idle_timer;
+    uint32_t _idle_deadline;
 
     // append (s + "\r\n") to _wbuffer
     //    void _AppendResponse(std::string s);
@@ -1,5 +1,6 @@
 #include "ServerImpl.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <iostream>
@@ -29,16 +30,18 @@ namespace Network {
 namespace STnonblock {
 
 // See Server.h
-ServerImpl::ServerImpl(std::shared_ptr<Afina::Storage> ps, std::shared_ptr<Logging::Service> pl) : Server(ps, pl) {}
+ServerImpl::ServerImpl(std::shared_ptr<Afina::Storage> ps, std::shared_ptr<Logging::Service> pl)
+    : Server(ps, pl), _idle_timeout(0), _started(std::chrono::steady_clock::now()), _idle(0) {}
 
 // See Server.h
 ServerImpl::~ServerImpl() {}
 
 // See Server.h
-void ServerImpl::Start(uint16_t port, uint32_t n_acceptors, uint32_t n_workers,
-                       std::chrono::microseconds = std::chrono::microseconds{5000000}) {
+void ServerImpl::Start(uint16_t port, uint32_t n_acceptors, uint32_t n_workers, std::chrono::microseconds timeout) {
     _logger = pLogging->select("network");
     _logger->info("Start network service");
+    _timeout = timeout;
+    _idle_timeout = std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count();
 
     sigset_t sig_mask;
     sigemptyset(&sig_mask);
@@ -134,7 +137,14 @@ void ServerImpl::OnRun() {
     bool run = true;
     std::array<struct epoll_event, 64> mod_list;
     while (run || !connections.empty()) {
-        int nmod = epoll_wait(epoll_descr, &mod_list[0], mod_list.size(), -1);
+        // Sleep until the next connection could become idle for too long
+        int timeout = -1;
+        uint32_t next;
+        if (_idle.NextExpiration(next)) {
+            timeout = std::max(int32_t(next - _Now()), 0);
+        }
+
+        int nmod = epoll_wait(epoll_descr, &mod_list[0], mod_list.size(), timeout);
         _logger->debug("Acceptor wokeup: {} events", nmod);
 
         for (int i = 0; i < nmod; i++) {
@@ -177,30 +187,48 @@ void ServerImpl::OnRun() {
 
             // Is it alive?
             if (!pc->isAlive() && !(pc->_event.events & EPOLLOUT)) {
-                if (epoll_ctl(epoll_descr, EPOLL_CTL_DEL, pc->_socket, &pc->_event)) {
-                    _logger->error("Failed to delete connection from epoll");
-                }
-
                 _logger->info("Closing connection on descriptor {}", pc->_socket);
-                pc->OnClose();
-                close(pc->_socket);
-                connections.erase(pc);
-                delete pc;
+                CloseConnection(epoll_descr, pc);
             } else if (pc->_event.events != old_mask) {
                 if (epoll_ctl(epoll_descr, EPOLL_CTL_MOD, pc->_socket, &pc->_event)) {
                     _logger->error("Failed to change connection event mask");
-
-                    pc->OnClose();
-                    close(pc->_socket);
-                    connections.erase(pc);
-                    delete pc;
+                    CloseConnection(epoll_descr, pc);
+                } else {
+                    TouchConnection(pc);
                 }
+            } else {
+                TouchConnection(pc);
             }
         }
+
+        _idle.Advance(_Now(), [this, epoll_descr](Connection &c) {
+            _logger->info("Closing idle connection on descriptor {}", c._socket);
+            CloseConnection(epoll_descr, &c);
+        });
     }
     assert(connections.empty());
 }
 
+void ServerImpl::CloseConnection(int epoll_descr, Connection *pc) {
+    if (epoll_ctl(epoll_descr, EPOLL_CTL_DEL, pc->_socket, &pc->_event)) {
+        _logger->error("Failed to delete connection from epoll");
+    }
+    _idle.Remove(*pc);
+    pc->OnClose();
+    close(pc->_socket);
+    connections.erase(pc);
+    delete pc;
+}
+
+void ServerImpl::TouchConnection(Connection *pc) {
+    if (_idle_timeout == 0) {
+        return;
+    }
+    _idle.Remove(*pc);
+    pc->_idle_deadline = _Now() + _idle_timeout;
+    _idle.Add(*pc);
+}
+
 void ServerImpl::OnNewConnection(int epoll_descr, bool to_accept) {
     for (;;) {
         struct sockaddr in_addr;
@@ -249,6 +277,8 @@ void ServerImpl::OnNewConnection(int epoll_descr, bool to_accept) {
                 close(pc->_socket);
                 connections.erase(pc);
                 delete pc;
+            } else {
+                TouchConnection(pc);
             }
         }
     }
@@ -1,12 +1,16 @@
 #ifndef AFINA_NETWORK_ST_NONBLOCKING_SERVER_H
 #define AFINA_NETWORK_ST_NONBLOCKING_SERVER_H
 
+#include <chrono>
 #include <set>
 #include <thread>
 //#include <vector>
 
+#include <afina/TimingWheel.h>
 #include <afina/network/Server.h>
 
+#include "Connection.h"
+
 namespace spdlog {
 class logger;
 }
@@ -43,6 +47,12 @@ protected:
     void OnRun();
     void OnNewConnection(int epoll_descr, bool to_accept = true);
 
+    // Closes and frees connection
+    void CloseConnection(int epoll_descr, Connection *pc);
+
+    // Postpones closing of idle connection, it has got some events
+    void TouchConnection(Connection *pc);
+
 private:
     friend class Connection;
     std::set<Connection *> connections;
@@ -63,6 +73,20 @@ private:
 
     // IO thread
     std::thread _work_thread;
+
+    // Connections without any events for that number of milliseconds are closed, 0 means never
+    uint32_t _idle_timeout;
+
+    // Milliseconds since server start
+    inline uint32_t _Now() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _started)
+            .count();
+    }
+
+    std::chrono::steady_clock::time_point _started;
+
+    // Idle timeouts of connections, by _Now() time
+    TimingWheel<Connection, &Connection::_idle_timer, &Connection::_idle_deadline> _idle;
 };
 
 } // namespace STnonblock
@@ -1,14 +1,20 @@
 #include "Parser.h"
 
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 
 #include <afina/execute/Add.h>
 #include <afina/execute/Append.h>
+#include <afina/execute/Cas.h>
 #include <afina/execute/Command.h>
+#include <afina/execute/Decr.h>
 #include <afina/execute/Delete.h>
 #include <afina/execute/Get.h>
+#include <afina/execute/Incr.h>
+#include <afina/execute/Prepend.h>
+#include <afina/execute/Replace.h>
 #include <afina/execute/Set.h>
 #include <afina/execute/Stats.h>
 
@@ -28,10 +34,13 @@ bool Parser::Parse(const char *input, const size_t size, size_t &parsed) {
         case State::sName: {
             if (c == ' ' || c == '\r') {
                 // std::cout << "parser debug: name='" << name << "'" << std::endl;
-                if (name == "set" || name == "add" || name == "append" || name == "prepend") {
+                if (name == "set" || name == "add" || name == "replace" || name == "append" || name == "prepend" ||
+                    name == "cas") {
                     state = State::spKey;
                 } else if (name == "get" || name == "gets") {
                     state = State::sgKey;
+                } else if (name == "incr" || name == "decr") {
+                    state = State::siKey;
                 } else if (name == "stats") {
                     state = State::sLF;
                     continue;
@@ -109,17 +118,9 @@ bool Parser::Parse(const char *input, const size_t size, size_t &parsed) {
                 state = State::spBytes;
                 // std::cout << "parser debug: ExprTime='" << exprtime << "'" << std::endl;
             } else if (c >= '0' && c <= '9') {
-                int32_t et = exprtime;
-                if (negative) {
-                    et -= (c - '0');
-                    if (et > exprtime) {
-                        throw std::runtime_error("Expire time field overflow");
-                    }
-                } else {
-                    et += (c - '0');
-                    if (et < exprtime) {
-                        throw std::runtime_error("Expire time field overflow");
-                    }
+                int64_t et = int64_t(exprtime) * 10 + (negative ? -(c - '0') : (c - '0'));
+                if (et > std::numeric_limits<int32_t>::max() || et < std::numeric_limits<int32_t>::min()) {
+                    throw std::runtime_error("Expire time field overflow");
                 }
                 exprtime = et;
             }
@@ -130,6 +131,8 @@ bool Parser::Parse(const char *input, const size_t size, size_t &parsed) {
             if (c == '\r') {
                 state = State::sLF;
                 // std::cout << "parser debug: bytes='" << bytes << "'" << std::endl;
+            } else if (c == ' ' && name == "cas") {
+                state = State::spCas;
             } else if (c >= '0' && c <= '9') {
                 uint32_t b = (bytes * 10) + (c - '0');
                 if (b < bytes) {
@@ -141,6 +144,47 @@ bool Parser::Parse(const char *input, const size_t size, size_t &parsed) {
             break;
         }
 
+        case State::spCas: {
+            if (c == '\r') {
+                state = State::sLF;
+            } else if (c >= '0' && c <= '9') {
+                uint64_t digit = c - '0';
+                if (cas_unique > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+                    throw std::runtime_error("Cas unique field overflow");
+                }
+                cas_unique = cas_unique * 10 + digit;
+            }
+            break;
+        }
+
+        case State::siKey: {
+            if (c == ' ') {
+                state = State::siDelta;
+                keys.push_back(curKey);
+                curKey.clear();
+            } else if (c == '\r') {
+                throw std::runtime_error("Client provides no delta");
+            } else {
+                curKey.push_back(c);
+            }
+            break;
+        }
+
+        case State::siDelta: {
+            if (c == '\r') {
+                state = State::sLF;
+            } else if (c >= '0' && c <= '9') {
+                uint64_t digit = c - '0';
+                if (delta > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+                    throw std::runtime_error("Delta field overflow");
+                }
+                delta = delta * 10 + digit;
+            } else {
+                throw std::runtime_error("Invalid numeric delta argument");
+            }
+            break;
+        }
+
         case State::sLF: {
             if (c == '\n') {
                 parse_complete = true;
@@ -172,10 +216,22 @@ std::unique_ptr<Execute::Command> Parser::Build(size_t &body_size) const {
         return std::unique_ptr<Execute::Command>(new Execute::Set(keys[0], flags, exprtime));
     } else if (name == "add") {
         return std::unique_ptr<Execute::Command>(new Execute::Add(keys[0], flags, exprtime));
+    } else if (name == "replace") {
+        return std::unique_ptr<Execute::Command>(new Execute::Replace(keys[0], flags, exprtime));
     } else if (name == "append") {
         return std::unique_ptr<Execute::Command>(new Execute::Append(keys[0], flags, exprtime));
+    } else if (name == "prepend") {
+        return std::unique_ptr<Execute::Command>(new Execute::Prepend(keys[0], flags, exprtime));
+    } else if (name == "incr") {
+        return std::unique_ptr<Execute::Command>(new Execute::Incr(keys[0], delta));
+    } else if (name == "decr") {
+        return std::unique_ptr<Execute::Command>(new Execute::Decr(keys[0], delta));
+    } else if (name == "cas") {
+        return std::unique_ptr<Execute::Command>(new Execute::Cas(keys[0], flags, exprtime, cas_unique));
     } else if (name == "get") {
         return std::unique_ptr<Execute::Command>(new Execute::Get(keys));
+    } else if (name == "gets") {
+        return std::unique_ptr<Execute::Command>(new Execute::Get(keys, true));
     } else if (name == "stats") {
         return std::unique_ptr<Execute::Command>(new Execute::Stats());
     } else {
@@ -193,6 +249,8 @@ void Parser::Reset() {
     flags = 0;
     bytes = 0;
     exprtime = 0;
+    cas_unique = 0;
+    delta = 0;
 }
 
 } // namespace Protocol
@@ -61,8 +61,22 @@ private:
      * - s: state for PUT and GET commands
      * - sp: for PUT commands only
      * - sg: for GET commands only
+     * - si: for INCR and DECR commands
      */
-    enum State : uint16_t { sCR, sLF, sName, spKey, spFlags, spExprTimeStart, spExprTime, spBytes, sgKey };
+    enum State : uint16_t {
+        sCR,
+        sLF,
+        sName,
+        spKey,
+        spFlags,
+        spExprTimeStart,
+        spExprTime,
+        spBytes,
+        spCas,
+        sgKey,
+        siKey,
+        siDelta
+    };
 
     // Current parser state
     State state;
@@ -88,6 +102,12 @@ private:
     // it's followed by an empty data block).
     uint32_t bytes;
 
+    // <cas unique> of cas command is a 64-bit version of the item client got with gets command
+    uint64_t cas_unique;
+
+    // <value> of incr/decr is the amount by which the client wants to change the item, 64-bit unsigned integer
+    uint64_t delta;
+
     bool negative;
     std::string curKey;
     bool parse_complete;
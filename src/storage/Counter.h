@@ -0,0 +1,69 @@
+#ifndef AFINA_STORAGE_COUNTER_H
+#define AFINA_STORAGE_COUNTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Afina {
+namespace Backend {
+
+// Max number of decimal digits in uint64_t, counter value never takes more bytes
+const size_t kCounterDigits = 20;
+
+/**
+ * Parses value of incr/decr counter: non empty decimal number which fits into uint64_t
+ *
+ * @return false if value isn't such number
+ */
+inline bool ParseCounter(const char *data, size_t size, uint64_t &result) {
+    if (size == 0 || size > kCounterDigits) {
+        return false;
+    }
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; i++) {
+        if (data[i] < '0' || data[i] > '9') {
+            return false;
+        }
+        uint64_t digit = data[i] - '0';
+        if (value > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+            return false;
+        }
+        value = value * 10 + digit;
+    }
+    result = value;
+    return true;
+}
+
+/**
+ * Writes decimal representation of value into buffer of at least kCounterDigits bytes
+ *
+ * @return number of written bytes
+ */
+inline size_t FormatCounter(uint64_t value, char *buffer) {
+    char digits[kCounterDigits];
+    size_t n = 0;
+    do {
+        digits[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value != 0);
+    for (size_t i = 0; i < n; i++) {
+        buffer[i] = digits[n - 1 - i];
+    }
+    return n;
+}
+
+/**
+ * Applies incr/decr to the counter value with memcached semantics: incr wraps around at 2^64, decr stops at 0
+ */
+inline uint64_t ApplyDelta(uint64_t value, uint64_t delta, bool decrement) {
+    if (decrement) {
+        return value > delta ? value - delta : 0;
+    }
+    return value + delta;
+}
+
+} // namespace Backend
+} // namespace Afina
+
+#endif // AFINA_STORAGE_COUNTER_H
@@ -0,0 +1,45 @@
+#include "ExpirySweeper.h"
+
+namespace Afina {
+namespace Backend {
+
+const size_t ExpirySweeper::kBatch;
+
+// See ExpirySweeper.h
+void ExpirySweeper::Start() {
+    std::unique_lock<std::mutex> lock(_m);
+    if (_running) {
+        return;
+    }
+    _running = true;
+    _thread = std::thread(&ExpirySweeper::_Run, this);
+}
+
+// See ExpirySweeper.h
+void ExpirySweeper::Stop() {
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _running = false;
+    }
+    _stop_cv.notify_all();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void ExpirySweeper::_Run() {
+    std::unique_lock<std::mutex> lock(_m);
+    while (_running) {
+        if (_stop_cv.wait_for(lock, _period, [this] { return !_running; })) {
+            break;
+        }
+
+        // Don't hold own lock while sweeping, so that Stop() doesn't have to wait for it
+        lock.unlock();
+        _sweep();
+        lock.lock();
+    }
+}
+
+} // namespace Backend
+} // namespace Afina
@@ -0,0 +1,54 @@
+#ifndef AFINA_STORAGE_EXPIRY_SWEEPER_H
+#define AFINA_STORAGE_EXPIRY_SWEEPER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Afina {
+namespace Backend {
+
+/**
+ * # Background thread freeing expired items
+ * Calls given sweep function once per period until stopped. Function is expected to check a bounded
+ * number of items (see kBatch) per storage lock acquisition, so clients are never blocked for long.
+ */
+class ExpirySweeper {
+public:
+    // Number of items to check under one lock
+    static const size_t kBatch = 1024;
+
+    ExpirySweeper(std::function<void()> sweep, std::chrono::milliseconds period = std::chrono::milliseconds{100})
+        : _sweep(std::move(sweep)), _period(period), _running(false) {}
+    ~ExpirySweeper() { Stop(); }
+
+    // Starts background thread, does nothing if it is running already
+    void Start();
+
+    // Stops background thread and waits for it
+    void Stop();
+
+private:
+    // Thread body
+    void _Run();
+
+    const std::function<void()> _sweep;
+
+    const std::chrono::milliseconds _period;
+
+    std::mutex _m;
+
+    // Wakes the thread up once it has to stop
+    std::condition_variable _stop_cv;
+
+    bool _running;
+
+    std::thread _thread;
+};
+
+} // namespace Backend
+} // namespace Afina
+
+#endif // AFINA_STORAGE_EXPIRY_SWEEPER_H
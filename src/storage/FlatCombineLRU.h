@@ -0,0 +1,155 @@
+#ifndef AFINA_STORAGE_FLAT_COMBINE_LRU_H
+#define AFINA_STORAGE_FLAT_COMBINE_LRU_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <afina/concurrency/FlatCombine.h>
+
+#include "ExpirySweeper.h"
+#include "SimpleLRU.h"
+
+namespace Afina {
+namespace Backend {
+
+/**
+ * # SimpleLRU thread safe version using flat combining
+ * Same as ThreadSafeSimplLRU, but calls are not serialized by a mutex. Each one is published for the
+ * combiner thread, which runs a batch of calls of all threads in a row, see Concurrency::FlatCombine.
+ * Under heavy load cache stays hot in one core and no thread goes to sleep on the lock
+ */
+class FlatCombineLRU : public SimpleLRU {
+public:
+    FlatCombineLRU(size_t max_size = 1024, Promotion promotion = Promotion::kAlways,
+                   std::chrono::milliseconds promotion_interval = std::chrono::milliseconds{60000},
+                   Admission admission = Admission::kNone)
+        : SimpleLRU(max_size, promotion, promotion_interval, admission), _sweeper([this] { _Sweep(); }) {}
+    ~FlatCombineLRU() override {}
+
+    // Starts background sweeping of expired items
+    void Start() override { _sweeper.Start(); }
+
+    // Stops background sweeping
+    void Stop() override { _sweeper.Stop(); }
+
+    // see SimpleLRU.h
+    bool Put(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override {
+        bool result;
+        _Execute([&] { result = SimpleLRU::Put(key, value, expire, flags); });
+        return result;
+    }
+
+    // see SimpleLRU.h
+    bool PutIfAbsent(const std::string &key, const std::string &value, uint32_t expire = 0,
+                     uint32_t flags = 0) override {
+        bool result;
+        _Execute([&] { result = SimpleLRU::PutIfAbsent(key, value, expire, flags); });
+        return result;
+    }
+
+    // see SimpleLRU.h
+    bool Set(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override {
+        bool result;
+        _Execute([&] { result = SimpleLRU::Set(key, value, expire, flags); });
+        return result;
+    }
+
+    // see SimpleLRU.h
+    CasResult Cas(const std::string &key, const std::string &value, uint64_t cas, uint32_t expire = 0,
+                  uint32_t flags = 0) override {
+        CasResult result;
+        _Execute([&] { result = SimpleLRU::Cas(key, value, cas, expire, flags); });
+        return result;
+    }
+
+    // see SimpleLRU.h
+    bool Append(const std::string &key, const std::string &data) override {
+        bool result;
+        _Execute([&] { result = SimpleLRU::Append(key, data); });
+        return result;
+    }
+
+    // see SimpleLRU.h
+    bool Prepend(const std::string &key, const std::string &data) override {
+        bool result;
+        _Execute([&] { result = SimpleLRU::Prepend(key, data); });
+        return result;
+    }
+
+    // see SimpleLRU.h
+    bool Incr(const std::string &key, uint64_t delta, uint64_t &result) override {
+        bool found;
+        _Execute([&] { found = SimpleLRU::Incr(key, delta, result); });
+        return found;
+    }
+
+    // see SimpleLRU.h
+    bool Decr(const std::string &key, uint64_t delta, uint64_t &result) override {
+        bool found;
+        _Execute([&] { found = SimpleLRU::Decr(key, delta, result); });
+        return found;
+    }
+
+    // see SimpleLRU.h
+    bool Delete(const std::string &key) override {
+        bool result;
+        _Execute([&] { result = SimpleLRU::Delete(key); });
+        return result;
+    }
+
+    // see SimpleLRU.h
+    bool Get(const std::string &key, std::string &value, uint32_t *flags = nullptr) override {
+        bool result;
+        _Execute([&] { result = SimpleLRU::Get(key, value, flags); });
+        return result;
+    }
+
+    // see SimpleLRU.h
+    bool GetRef(const std::string &key, ItemRef &item) override {
+        bool result;
+        _Execute([&] { result = SimpleLRU::GetRef(key, item); });
+        return result;
+    }
+
+    // see SimpleLRU.h, all keys are resolved by one operation
+    size_t MultiGet(const std::vector<std::string> &keys, std::vector<ItemRef> &items) override {
+        size_t result;
+        _Execute([&] { result = SimpleLRU::MultiGet(keys, items); });
+        return result;
+    }
+
+private:
+    // Operation published for the combiner, refers to the callable living on the stack of the caller
+    class call {
+    public:
+        template <typename F> call(F &f) : _run(&_Run<F>), _f(&f) {}
+
+        void operator()() { _run(_f); }
+
+    private:
+        template <typename F> static void _Run(void *f) { (*static_cast<F *>(f))(); }
+
+        void (*_run)(void *);
+        void *_f;
+    };
+
+    // Runs f exclusively with all other calls
+    template <typename F> void _Execute(F f) {
+        call op(f);
+        _fc.Execute(op);
+    }
+
+    // Sweeps expired items, one batch per operation
+    void _Sweep() { _Execute([this] { SimpleLRU::SweepExpired(ExpirySweeper::kBatch); }); }
+
+    Concurrency::FlatCombine<call> _fc;
+
+    // Declared last so that its thread is stopped before the rest of the storage is destroyed
+    ExpirySweeper _sweeper;
+};
+
+} // namespace Backend
+} // namespace Afina
+
+#endif // AFINA_STORAGE_FLAT_COMBINE_LRU_H
@@ -0,0 +1,53 @@
+#include "FrequencySketch.h"
+
+#include <algorithm>
+
+namespace Afina {
+namespace Backend {
+
+const uint8_t FrequencySketch::kMaxCount;
+const size_t FrequencySketch::kDepth;
+
+// See FrequencySketch.h
+FrequencySketch::FrequencySketch(size_t expected_items) : _width(64), _additions(0) {
+    while (_width < expected_items) {
+        _width <<= 1;
+    }
+    _table.assign(kDepth * _width, 0);
+    _sample_size = 10 * _width;
+}
+
+// See FrequencySketch.h
+void FrequencySketch::Increment(uint64_t hash) {
+    bool added = false;
+    for (size_t row = 0; row < kDepth; row++) {
+        uint8_t &counter = _table[_Index(hash, row)];
+        if (counter < kMaxCount) {
+            counter++;
+            added = true;
+        }
+    }
+
+    if (added && ++_additions >= _sample_size) {
+        _Age();
+    }
+}
+
+// See FrequencySketch.h
+uint32_t FrequencySketch::Estimate(uint64_t hash) const {
+    uint32_t result = kMaxCount;
+    for (size_t row = 0; row < kDepth; row++) {
+        result = std::min<uint32_t>(result, _table[_Index(hash, row)]);
+    }
+    return result;
+}
+
+void FrequencySketch::_Age() {
+    for (auto &counter : _table) {
+        counter >>= 1;
+    }
+    _additions /= 2;
+}
+
+} // namespace Backend
+} // namespace Afina
@@ -0,0 +1,63 @@
+#ifndef AFINA_STORAGE_FREQUENCY_SKETCH_H
+#define AFINA_STORAGE_FREQUENCY_SKETCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Afina {
+namespace Backend {
+
+/**
+ * # Count-min sketch of key access frequencies
+ * Approximates how many times key has been seen recently using 4 rows of small saturating counters, estimate
+ * is minimum over rows, so it is never less than real value (until aging). Once number of increments reaches
+ * sample size all counters are halved, so that old popularity fades out and sketch adapts to changing workload.
+ *
+ * Keys are identified by their 64 bit hash (see HashKey)
+ */
+class FrequencySketch {
+public:
+    /**
+     * @param expected_items approximate number of distinct items cache could hold
+     */
+    FrequencySketch(size_t expected_items);
+
+    // Records one more access to the key
+    void Increment(uint64_t hash);
+
+    // Returns estimated number of recent accesses to the key, at most kMaxCount
+    uint32_t Estimate(uint64_t hash) const;
+
+    // Counters saturate at that value
+    static const uint8_t kMaxCount = 15;
+
+private:
+    static const size_t kDepth = 4;
+
+    // Position of the counter for the given key in the given row
+    inline size_t _Index(uint64_t hash, size_t row) const {
+        uint64_t h = hash + row * ((hash >> 32) | 1) * 0x9e3779b97f4a7c15ULL;
+        return row * _width + ((h ^ (h >> 29)) & (_width - 1));
+    }
+
+    // Halves all counters
+    void _Age();
+
+    // kDepth rows by _width counters
+    std::vector<uint8_t> _table;
+
+    // Number of counters in one row, power of 2
+    size_t _width;
+
+    // Increments since last aging
+    size_t _additions;
+
+    // Aging period
+    size_t _sample_size;
+};
+
+} // namespace Backend
+} // namespace Afina
+
+#endif // AFINA_STORAGE_FREQUENCY_SKETCH_H
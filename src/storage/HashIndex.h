@@ -0,0 +1,218 @@
+#ifndef AFINA_STORAGE_HASH_INDEX_H
+#define AFINA_STORAGE_HASH_INDEX_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace Afina {
+namespace Backend {
+
+/**
+ * Hash function used by storage indexes. It differs from std::hash on purpose: ShardedLRU selects
+ * shard using std::hash, so index inside of the shard must not depend on the same bits
+ */
+inline uint64_t HashKey(const char *data, size_t size) {
+    const uint64_t m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
+
+    uint64_t h = 0x2f0f3d6b3a1c5e97ULL ^ (size * m);
+    const char *end = data + (size & ~size_t(7));
+    for (; data != end; data += 8) {
+        uint64_t k;
+        std::memcpy(&k, data, sizeof(k));
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+
+    uint64_t tail = 0;
+    std::memcpy(&tail, data, size & 7);
+    if (size & 7) {
+        h ^= tail;
+        h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
+inline uint64_t HashKey(const std::string &key) { return HashKey(key.data(), key.size()); }
+
+/**
+ * # Open addressing index of storage nodes
+ * Maps keys to nodes which are owned by somebody else (LRU list for example). Table is a single flat
+ * array of (hash, node) slots with linear probing, so lookup usually touches one cache line of the
+ * table and then the node itself. Stored hashes allow to skip key comparison for almost all
+ * collisions and to grow table without touching nodes at all.
+ *
+ * Deletion uses backward shift, so there are no tombstones and probe sequences never degrade.
+ *
+ * KeyOf must be a functor returning std::pair<const char *, size_t> with the key of a node
+ */
+template <typename Node, typename KeyOf> class HashIndex {
+public:
+    HashIndex(size_t capacity = 16) : _size(0) { _Allocate(_RoundUp(capacity)); }
+
+    inline size_t size() const { return _size; }
+    inline bool empty() const { return _size == 0; }
+
+    /**
+     * Returns node with the given key or nullptr if there is no such node
+     */
+    Node *Find(const char *key, size_t key_size, uint64_t hash) const {
+        for (size_t pos = hash & _mask;; pos = (pos + 1) & _mask) {
+            const slot &s = _slots[pos];
+            if (s.node == nullptr) {
+                return nullptr;
+            }
+            if (s.hash == hash && _Equals(s.node, key, key_size)) {
+                return s.node;
+            }
+        }
+    }
+
+    inline Node *Find(const std::string &key) const { return Find(key.data(), key.size(), HashKey(key)); }
+
+    /**
+     * Adds node into index. Caller guarantees that there is no node with the same key yet
+     */
+    void Insert(Node *node, uint64_t hash) {
+        if ((_size + 1) * 4 > _slots.size() * 3) {
+            _Grow();
+        }
+        _InsertNoGrow(node, hash);
+        _size++;
+    }
+
+    /**
+     * Removes given node from index, returns false if node isn't indexed
+     */
+    bool Erase(const Node *node, uint64_t hash) {
+        size_t pos = hash & _mask;
+        for (;; pos = (pos + 1) & _mask) {
+            if (_slots[pos].node == nullptr) {
+                return false;
+            }
+            if (_slots[pos].node == node) {
+                break;
+            }
+        }
+
+        // Backward shift: move following entries of the cluster closer to their home position
+        size_t hole = pos;
+        for (size_t next = (hole + 1) & _mask; _slots[next].node != nullptr; next = (next + 1) & _mask) {
+            size_t home = _slots[next].hash & _mask;
+            // Entry could fill the hole if its home isn't located in (hole, next] cyclically
+            if (((next - home) & _mask) >= ((next - hole) & _mask)) {
+                _slots[hole] = _slots[next];
+                hole = next;
+            }
+        }
+        _slots[hole].node = nullptr;
+        _size--;
+        return true;
+    }
+
+    /**
+     * Points slot of the old node to the new one, for example after node has been reallocated.
+     * Both nodes must have the same key
+     */
+    bool Replace(const Node *old_node, Node *new_node, uint64_t hash) {
+        for (size_t pos = hash & _mask;; pos = (pos + 1) & _mask) {
+            if (_slots[pos].node == nullptr) {
+                return false;
+            }
+            if (_slots[pos].node == old_node) {
+                _slots[pos].node = new_node;
+                return true;
+            }
+        }
+    }
+
+    /**
+     * Hints CPU to load home slot of the given hash into cache
+     */
+    inline void Prefetch(uint64_t hash) const { __builtin_prefetch(&_slots[hash & _mask]); }
+
+    void Clear() {
+        for (auto &s : _slots) {
+            s.node = nullptr;
+        }
+        _size = 0;
+    }
+
+    /**
+     * Calls f(node) for every indexed node, order is unspecified
+     */
+    template <typename F> void ForEach(F f) const {
+        for (auto &s : _slots) {
+            if (s.node != nullptr) {
+                f(s.node);
+            }
+        }
+    }
+
+private:
+    struct slot {
+        uint64_t hash;
+        Node *node;
+    };
+
+    static size_t _RoundUp(size_t capacity) {
+        size_t result = 16;
+        while (result < capacity) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    static bool _Equals(const Node *node, const char *key, size_t key_size) {
+        std::pair<const char *, size_t> node_key = KeyOf()(*node);
+        return node_key.second == key_size && std::memcmp(node_key.first, key, key_size) == 0;
+    }
+
+    void _Allocate(size_t n_slots) {
+        _slots.assign(n_slots, slot{0, nullptr});
+        _mask = n_slots - 1;
+    }
+
+    void _InsertNoGrow(Node *node, uint64_t hash) {
+        size_t pos = hash & _mask;
+        while (_slots[pos].node != nullptr) {
+            pos = (pos + 1) & _mask;
+        }
+        _slots[pos].hash = hash;
+        _slots[pos].node = node;
+    }
+
+    void _Grow() {
+        std::vector<slot> old;
+        old.swap(_slots);
+        _Allocate(old.size() * 2);
+        for (auto &s : old) {
+            if (s.node != nullptr) {
+                _InsertNoGrow(s.node, s.hash);
+            }
+        }
+    }
+
+    // Table itself, size is always power of 2
+    std::vector<slot> _slots;
+
+    // _slots.size() - 1
+    size_t _mask;
+
+    // Number of nodes in the index
+    size_t _size;
+};
+
+} // namespace Backend
+} // namespace Afina
+
+#endif // AFINA_STORAGE_HASH_INDEX_H
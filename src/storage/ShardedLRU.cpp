@@ -0,0 +1,149 @@
+#include "ShardedLRU.h"
+
+#include <functional>
+#include <stdexcept>
+
+namespace Afina {
+namespace Backend {
+
+// See ShardedLRU.h
+ShardedLRU::ShardedLRU(size_t max_size, size_t n_shards, SimpleLRU::Promotion promotion,
+                       std::chrono::milliseconds promotion_interval, SimpleLRU::Admission admission)
+    : _sweeper([this] { _Sweep(); }) {
+    if (n_shards == 0) {
+        throw std::invalid_argument("Number of shards must be positive");
+    }
+
+    // Split memory limit so that total capacity stays the same, the remainder goes to the first shards
+    _shards.reserve(n_shards);
+    for (size_t i = 0; i < n_shards; i++) {
+        size_t shard_size = max_size / n_shards + (i < max_size % n_shards ? 1 : 0);
+        _shards.emplace_back(new shard(shard_size, promotion, promotion_interval, admission));
+    }
+}
+
+// See ShardedLRU.h
+ShardedLRU::shard &ShardedLRU::_GetShard(const std::string &key) {
+    return *_shards[_ShardIndex(key)];
+}
+
+void ShardedLRU::_Sweep() {
+    for (auto &s : _shards) {
+        std::unique_lock<std::mutex> lock(s->m);
+        s->lru.SweepExpired(ExpirySweeper::kBatch);
+    }
+}
+
+// See ShardedLRU.h
+bool ShardedLRU::Put(const std::string &key, const std::string &value, uint32_t expire, uint32_t flags) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.Put(key, value, expire, flags);
+}
+
+// See ShardedLRU.h
+bool ShardedLRU::PutIfAbsent(const std::string &key, const std::string &value, uint32_t expire, uint32_t flags) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.PutIfAbsent(key, value, expire, flags);
+}
+
+// See ShardedLRU.h
+bool ShardedLRU::Set(const std::string &key, const std::string &value, uint32_t expire, uint32_t flags) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.Set(key, value, expire, flags);
+}
+
+// See ShardedLRU.h
+Storage::CasResult ShardedLRU::Cas(const std::string &key, const std::string &value, uint64_t cas, uint32_t expire,
+                                   uint32_t flags) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.Cas(key, value, cas, expire, flags);
+}
+
+// See ShardedLRU.h
+bool ShardedLRU::Append(const std::string &key, const std::string &data) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.Append(key, data);
+}
+
+// See ShardedLRU.h
+bool ShardedLRU::Prepend(const std::string &key, const std::string &data) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.Prepend(key, data);
+}
+
+// See ShardedLRU.h
+bool ShardedLRU::Incr(const std::string &key, uint64_t delta, uint64_t &result) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.Incr(key, delta, result);
+}
+
+// See ShardedLRU.h
+bool ShardedLRU::Decr(const std::string &key, uint64_t delta, uint64_t &result) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.Decr(key, delta, result);
+}
+
+// See ShardedLRU.h
+bool ShardedLRU::Delete(const std::string &key) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.Delete(key);
+}
+
+// See ShardedLRU.h
+bool ShardedLRU::Get(const std::string &key, std::string &value, uint32_t *flags) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.Get(key, value, flags);
+}
+
+// See ShardedLRU.h
+bool ShardedLRU::GetRef(const std::string &key, ItemRef &item) {
+    shard &s = _GetShard(key);
+    std::unique_lock<std::mutex> lock(s.m);
+    return s.lru.GetRef(key, item);
+}
+
+// See ShardedLRU.h
+size_t ShardedLRU::MultiGet(const std::vector<std::string> &keys, std::vector<ItemRef> &items) {
+    items.clear();
+    items.resize(keys.size());
+
+    // Counting sort of key positions by shard
+    std::vector<uint32_t> shard_of(keys.size());
+    std::vector<uint32_t> begin(_shards.size() + 1, 0);
+    for (size_t i = 0; i < keys.size(); i++) {
+        shard_of[i] = _ShardIndex(keys[i]);
+        begin[shard_of[i] + 1]++;
+    }
+    for (size_t i = 0; i < _shards.size(); i++) {
+        begin[i + 1] += begin[i];
+    }
+    std::vector<uint32_t> positions(keys.size());
+    std::vector<uint32_t> next(begin.begin(), begin.end() - 1);
+    for (size_t i = 0; i < keys.size(); i++) {
+        positions[next[shard_of[i]]++] = i;
+    }
+
+    size_t found = 0;
+    for (size_t i = 0; i < _shards.size(); i++) {
+        if (begin[i] == begin[i + 1]) {
+            continue;
+        }
+        shard &s = *_shards[i];
+        std::unique_lock<std::mutex> lock(s.m);
+        found += s.lru.GetRefs(keys, positions.data() + begin[i], begin[i + 1] - begin[i], items);
+    }
+    return found;
+}
+
+} // namespace Backend
+} // namespace Afina
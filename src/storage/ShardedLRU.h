@@ -0,0 +1,111 @@
+#ifndef AFINA_STORAGE_SHARDED_LRU_H
+#define AFINA_STORAGE_SHARDED_LRU_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <afina/Storage.h>
+
+#include "ExpirySweeper.h"
+#include "SimpleLRU.h"
+
+namespace Afina {
+namespace Backend {
+
+/**
+ * # Lock striped SimpleLRU
+ * Keys are hashed onto a fixed number of independent SimpleLRU shards, each one has its own
+ * lock and its own part of the memory budget. Operations on keys from different shards never
+ * contend with each other, so throughput scales with number of workers much better than with
+ * one global lock.
+ *
+ * Note that LRU order is maintained per shard only, so eviction is an approximation of the global LRU.
+ */
+class ShardedLRU : public Afina::Storage {
+public:
+    ShardedLRU(size_t max_size = 1024, size_t n_shards = 8,
+               SimpleLRU::Promotion promotion = SimpleLRU::Promotion::kAlways,
+               std::chrono::milliseconds promotion_interval = std::chrono::milliseconds{60000},
+               SimpleLRU::Admission admission = SimpleLRU::Admission::kNone);
+    ~ShardedLRU() override {}
+
+    // Starts background sweeping of expired items
+    void Start() override { _sweeper.Start(); }
+
+    // Stops background sweeping
+    void Stop() override { _sweeper.Stop(); }
+
+    // Implements Afina::Storage interface
+    bool Put(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    bool PutIfAbsent(const std::string &key, const std::string &value, uint32_t expire = 0,
+                     uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    bool Set(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    CasResult Cas(const std::string &key, const std::string &value, uint64_t cas, uint32_t expire = 0,
+                  uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    bool Append(const std::string &key, const std::string &data) override;
+
+    // Implements Afina::Storage interface
+    bool Prepend(const std::string &key, const std::string &data) override;
+
+    // Implements Afina::Storage interface
+    bool Incr(const std::string &key, uint64_t delta, uint64_t &result) override;
+
+    // Implements Afina::Storage interface
+    bool Decr(const std::string &key, uint64_t delta, uint64_t &result) override;
+
+    // Implements Afina::Storage interface
+    bool Delete(const std::string &key) override;
+
+    // Implements Afina::Storage interface
+    bool Get(const std::string &key, std::string &value, uint32_t *flags = nullptr) override;
+
+    // Implements Afina::Storage interface
+    bool GetRef(const std::string &key, ItemRef &item) override;
+
+    // Implements Afina::Storage interface. Keys are grouped by shard, so every shard is locked once
+    size_t MultiGet(const std::vector<std::string> &keys, std::vector<ItemRef> &items) override;
+
+    inline size_t ShardsCount() const { return _shards.size(); }
+
+private:
+    // One stripe of the storage, padded to the cache line so that locks of
+    // neighbour shards don't share it
+    struct alignas(64) shard {
+        shard(size_t max_size, SimpleLRU::Promotion promotion, std::chrono::milliseconds promotion_interval,
+              SimpleLRU::Admission admission)
+            : lru(max_size, promotion, promotion_interval, admission) {}
+
+        std::mutex m;
+        SimpleLRU lru;
+    };
+
+    // Returns shard responsible for the given key
+    shard &_GetShard(const std::string &key);
+
+    // Index of the shard responsible for the given key
+    inline size_t _ShardIndex(const std::string &key) const { return std::hash<std::string>()(key) % _shards.size(); }
+
+    // Sweeps expired items, one batch per shard, each one under its own lock
+    void _Sweep();
+
+    std::vector<std::unique_ptr<shard>> _shards;
+
+    // Declared last so that its thread is stopped before shards are destroyed
+    ExpirySweeper _sweeper;
+};
+
+} // namespace Backend
+} // namespace Afina
+
+#endif // AFINA_STORAGE_SHARDED_LRU_H
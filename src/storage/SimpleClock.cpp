@@ -0,0 +1,397 @@
+#include "SimpleClock.h"
+#include "Counter.h"
+#include "Version.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+namespace Afina {
+namespace Backend {
+
+const size_t SimpleClock::kPrefetchBatch;
+
+// See SimpleClock.h
+SimpleClock::~SimpleClock() {
+    for (clock_node *node : _ring) {
+        if (node != nullptr) {
+            _Unref(node);
+        }
+    }
+}
+
+// See SimpleClock.h
+SimpleClock::clock_node *SimpleClock::_AllocNode(const char *key, size_t key_size, uint64_t hash, size_t capacity) {
+    void *mem = std::malloc(EntrySize(key_size, capacity));
+    if (mem == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    clock_node *node = new (mem) clock_node;
+    node->hash = hash;
+    node->key_size = key_size;
+    node->value_size = 0;
+    node->cas = 0;
+    node->capacity = capacity;
+    node->slot = 0;
+    node->expire = 0;
+    node->flags = 0;
+    node->referenced.store(false, std::memory_order_relaxed);
+    node->refs.store(1, std::memory_order_relaxed);
+    std::memcpy(node->key(), key, key_size);
+    return node;
+}
+
+void SimpleClock::_Place(clock_node *node) {
+    if (_free_slots.empty()) {
+        node->slot = _ring.size();
+        _ring.push_back(node);
+    } else {
+        node->slot = _free_slots.back();
+        _free_slots.pop_back();
+        _ring[node->slot] = node;
+    }
+}
+
+void SimpleClock::_Delete(clock_node &node) {
+    _index.Erase(&node, node.hash);
+    _expiry.Remove(node);
+    _ring[node.slot] = nullptr;
+    _free_slots.push_back(node.slot);
+    _size -= node.size();
+    _Unref(&node);
+}
+
+void SimpleClock::_Unref(void *node) {
+    clock_node *p = static_cast<clock_node *>(node);
+    if (p->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        p->~clock_node();
+        std::free(p);
+    }
+}
+
+void SimpleClock::_Evict() {
+    // There is at least one node in the ring, so hand finds a victim during the second pass at most
+    for (;; _hand = (_hand + 1) % _ring.size()) {
+        clock_node *node = _ring[_hand];
+        if (node == nullptr) {
+            continue;
+        }
+        if (node->referenced.load(std::memory_order_relaxed)) {
+            node->referenced.store(false, std::memory_order_relaxed);
+            continue;
+        }
+        _Delete(*node);
+        _hand = (_hand + 1) % _ring.size();
+        return;
+    }
+}
+
+SimpleClock::clock_node *SimpleClock::_FindAlive(const std::string &key, uint64_t hash) {
+    clock_node *found = _index.Find(key.data(), key.size(), hash);
+    if (found != nullptr && found->expire != 0 && _IsExpired(*found, std::time(nullptr))) {
+        _Delete(*found);
+        return nullptr;
+    }
+    return found;
+}
+
+bool SimpleClock::_PutNew(const std::string &key, uint64_t hash, const std::string &value, uint32_t expire,
+                         uint32_t flags) {
+    std::size_t entry_size = EntrySize(key.size(), value.size());
+    if (entry_size > _max_size) {
+        return false;
+    }
+    while (_size + entry_size > _max_size) {
+        _Evict();
+    }
+
+    clock_node *node = _AllocNode(key.data(), key.size(), hash, value.size());
+    std::memcpy(node->value(), value.data(), value.size());
+    node->value_size = value.size();
+    node->cas = NextVersion();
+    node->flags = flags;
+    _SetExpire(*node, expire);
+    _Place(node);
+    _index.Insert(node, hash);
+    _size += entry_size;
+    return true;
+}
+
+bool SimpleClock::_Set(clock_node &node, const std::string &value, uint32_t expire, uint32_t flags) {
+    std::size_t val_size = value.size();
+    if (EntrySize(node.key_size, val_size) > _max_size) {
+        return false;
+    }
+
+    // Value fits into the node, doesn't waste more than a half of it and isn't pinned: update in place
+    if (val_size <= node.capacity && val_size >= node.capacity / 2 && node.refs.load(std::memory_order_acquire) == 1) {
+        std::memcpy(node.value(), value.data(), val_size);
+        node.value_size = val_size;
+        node.cas = NextVersion();
+        node.flags = flags;
+        _SetExpire(node, expire);
+        node.referenced.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Otherwise node gets reallocated
+    clock_node &new_node = _Reallocate(node, val_size);
+    std::memcpy(new_node.value(), value.data(), val_size);
+    new_node.value_size = val_size;
+    new_node.cas = NextVersion();
+    new_node.flags = flags;
+    _SetExpire(new_node, expire);
+    _Unref(&node);
+    return true;
+}
+
+bool SimpleClock::_Concat(clock_node &node, const std::string &data, bool prepend) {
+    std::size_t val_size = node.value_size + data.size();
+    if (EntrySize(node.key_size, val_size) > _max_size) {
+        return false;
+    }
+    node.referenced.store(true, std::memory_order_relaxed);
+
+    // See SimpleLRU::_Concat
+    if (val_size <= node.capacity && (!prepend || node.refs.load(std::memory_order_acquire) == 1)) {
+        if (prepend) {
+            std::memmove(node.value() + data.size(), node.value(), node.value_size);
+            std::memcpy(node.value(), data.data(), data.size());
+        } else {
+            std::memcpy(node.value() + node.value_size, data.data(), data.size());
+        }
+        node.value_size = val_size;
+        node.cas = NextVersion();
+        return true;
+    }
+
+    std::size_t capacity = std::min(val_size + val_size / 2, _max_size - EntrySize(node.key_size, 0));
+    clock_node &new_node = _Reallocate(node, capacity);
+    char *dst = new_node.value();
+    if (prepend) {
+        std::memcpy(dst, data.data(), data.size());
+        dst += data.size();
+    }
+    std::memcpy(dst, node.value(), node.value_size);
+    if (!prepend) {
+        std::memcpy(dst + node.value_size, data.data(), data.size());
+    }
+    new_node.value_size = val_size;
+    new_node.cas = NextVersion();
+    _Unref(&node);
+    return true;
+}
+
+bool SimpleClock::_AddDelta(clock_node &node, uint64_t delta, bool decrement, uint64_t &result) {
+    uint64_t value;
+    if (!ParseCounter(node.value(), node.value_size, value)) {
+        throw std::invalid_argument("cannot increment or decrement non-numeric value");
+    }
+    result = ApplyDelta(value, delta, decrement);
+    node.referenced.store(true, std::memory_order_relaxed);
+
+    char digits[kCounterDigits];
+    size_t size = FormatCounter(result, digits);
+    clock_node *target = &node;
+    if (size > node.capacity || node.refs.load(std::memory_order_acquire) != 1) {
+        // Reserve room for any counter value, so that node is reallocated at most once
+        size_t capacity = std::min(std::max<size_t>(node.capacity, kCounterDigits),
+                                   _max_size - EntrySize(node.key_size, 0));
+        if (capacity < size) {
+            // Counter doesn't fit into the cache anymore, just like too big value
+            _Delete(node);
+            return false;
+        }
+        target = &_Reallocate(node, capacity);
+        _Unref(&node);
+    }
+    std::memcpy(target->value(), digits, size);
+    target->value_size = size;
+    target->cas = NextVersion();
+    return true;
+}
+
+SimpleClock::clock_node &SimpleClock::_Reallocate(clock_node &node, size_t capacity) {
+    // Take node out of the ring first, so that hand couldn't evict it while we are making room for the new one
+    std::size_t new_size = EntrySize(node.key_size, capacity);
+    uint32_t slot = node.slot;
+    _ring[slot] = nullptr;
+    _size -= node.size();
+    while (_size + new_size > _max_size) {
+        _Evict();
+    }
+
+    clock_node *new_node = _AllocNode(node.key(), node.key_size, node.hash, capacity);
+    new_node->flags = node.flags;
+    _expiry.Remove(node);
+    _SetExpire(*new_node, node.expire);
+    new_node->slot = slot;
+    new_node->referenced.store(true, std::memory_order_relaxed);
+    _ring[slot] = new_node;
+    _index.Replace(&node, new_node, node.hash);
+    _size += new_size;
+    return *new_node;
+}
+
+void SimpleClock::_SetExpire(clock_node &node, uint32_t expire) {
+    if (node.expire == expire) {
+        return;
+    }
+    _expiry.Remove(node);
+    node.expire = expire;
+    if (expire != 0) {
+        _expiry.Add(node);
+    }
+}
+
+// See SimpleClock.h
+bool SimpleClock::Put(const std::string &key, const std::string &value, uint32_t expire, uint32_t flags) {
+    uint64_t hash = HashKey(key);
+    clock_node *found = _FindAlive(key, hash);
+    if (found != nullptr) {
+        return _Set(*found, value, expire, flags);
+    }
+    return _PutNew(key, hash, value, expire, flags);
+}
+
+// See SimpleClock.h
+bool SimpleClock::PutIfAbsent(const std::string &key, const std::string &value, uint32_t expire, uint32_t flags) {
+    uint64_t hash = HashKey(key);
+    if (_FindAlive(key, hash) != nullptr) {
+        return false;
+    }
+    return _PutNew(key, hash, value, expire, flags);
+}
+
+// See SimpleClock.h
+bool SimpleClock::Set(const std::string &key, const std::string &value, uint32_t expire, uint32_t flags) {
+    clock_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    return _Set(*found, value, expire, flags);
+}
+
+// See SimpleClock.h
+Storage::CasResult SimpleClock::Cas(const std::string &key, const std::string &value, uint64_t cas, uint32_t expire,
+                                 uint32_t flags) {
+    clock_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return CasResult::kNotFound;
+    }
+    if (found->cas != cas) {
+        return CasResult::kExists;
+    }
+    return _Set(*found, value, expire, flags) ? CasResult::kStored : CasResult::kNotStored;
+}
+
+// See SimpleClock.h
+bool SimpleClock::Append(const std::string &key, const std::string &data) {
+    clock_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    return _Concat(*found, data, false);
+}
+
+// See SimpleClock.h
+bool SimpleClock::Prepend(const std::string &key, const std::string &data) {
+    clock_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    return _Concat(*found, data, true);
+}
+
+// See SimpleClock.h
+bool SimpleClock::Incr(const std::string &key, uint64_t delta, uint64_t &result) {
+    clock_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    return _AddDelta(*found, delta, false, result);
+}
+
+// See SimpleClock.h
+bool SimpleClock::Decr(const std::string &key, uint64_t delta, uint64_t &result) {
+    clock_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    return _AddDelta(*found, delta, true, result);
+}
+
+// See SimpleClock.h
+bool SimpleClock::Delete(const std::string &key) {
+    clock_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    _Delete(*found);
+    return true;
+}
+
+// See SimpleClock.h
+bool SimpleClock::Get(const std::string &key, std::string &value, uint32_t *flags) {
+    clock_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    // Avoid writing into the node cache line if bit is already set
+    if (!found->referenced.load(std::memory_order_relaxed)) {
+        found->referenced.store(true, std::memory_order_relaxed);
+    }
+    value.assign(found->value(), found->value_size);
+    if (flags != nullptr) {
+        *flags = found->flags;
+    }
+    return true;
+}
+
+// See SimpleClock.h
+bool SimpleClock::GetRef(const std::string &key, ItemRef &item) { return _GetRef(key, HashKey(key), item); }
+
+// See SimpleClock.h
+size_t SimpleClock::MultiGet(const std::vector<std::string> &keys, std::vector<ItemRef> &items) {
+    items.clear();
+    items.resize(keys.size());
+    size_t found = 0;
+    uint64_t hashes[kPrefetchBatch];
+    for (size_t i = 0; i < keys.size(); i += kPrefetchBatch) {
+        size_t batch = std::min(kPrefetchBatch, keys.size() - i);
+        for (size_t j = 0; j < batch; j++) {
+            hashes[j] = HashKey(keys[i + j]);
+            _index.Prefetch(hashes[j]);
+        }
+        for (size_t j = 0; j < batch; j++) {
+            if (_GetRef(keys[i + j], hashes[j], items[i + j])) {
+                found++;
+            }
+        }
+    }
+    return found;
+}
+
+bool SimpleClock::_GetRef(const std::string &key, uint64_t hash, ItemRef &item) {
+    clock_node *found = _FindAlive(key, hash);
+    if (found == nullptr) {
+        return false;
+    }
+    if (!found->referenced.load(std::memory_order_relaxed)) {
+        found->referenced.store(true, std::memory_order_relaxed);
+    }
+    found->refs.fetch_add(1, std::memory_order_relaxed);
+    item = ItemRef(found->value(), found->value_size, found->flags, found->cas, found, &SimpleClock::_Unref);
+    return true;
+}
+
+// See SimpleClock.h
+size_t SimpleClock::SweepExpired(size_t budget) {
+    return _expiry.Advance(std::time(nullptr), [this](clock_node &node) { _Delete(node); }, budget);
+}
+
+} // namespace Backend
+} // namespace Afina
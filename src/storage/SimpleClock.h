@@ -0,0 +1,209 @@
+#ifndef AFINA_STORAGE_SIMPLE_CLOCK_H
+#define AFINA_STORAGE_SIMPLE_CLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include <afina/Storage.h>
+#include <afina/TimingWheel.h>
+
+#include "HashIndex.h"
+
+namespace Afina {
+namespace Backend {
+
+/**
+ * # CLOCK (second chance) cache
+ * Items are kept in a ring, each one has a reference bit that is set on read. On insert clock hand sweeps
+ * the ring: referenced items lose their bit and survive, the first item without bit gets evicted. So it
+ * approximates LRU, but read never relinks anything, it only sets a bit (and only if it isn't set yet).
+ *
+ * That is NOT thread safe implementaiton!!
+ */
+class SimpleClock : public Afina::Storage {
+public:
+    SimpleClock(size_t max_size = 1024) : _max_size(max_size), _size(0), _hand(0), _expiry(std::time(nullptr)) {}
+
+    ~SimpleClock() override;
+
+    // Implements Afina::Storage interface
+    bool Put(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    bool PutIfAbsent(const std::string &key, const std::string &value, uint32_t expire = 0,
+                     uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    bool Set(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    CasResult Cas(const std::string &key, const std::string &value, uint64_t cas, uint32_t expire = 0,
+                  uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    bool Append(const std::string &key, const std::string &data) override;
+
+    // Implements Afina::Storage interface
+    bool Prepend(const std::string &key, const std::string &data) override;
+
+    // Implements Afina::Storage interface
+    bool Incr(const std::string &key, uint64_t delta, uint64_t &result) override;
+
+    // Implements Afina::Storage interface
+    bool Decr(const std::string &key, uint64_t delta, uint64_t &result) override;
+
+    // Implements Afina::Storage interface
+    bool Delete(const std::string &key) override;
+
+    // Implements Afina::Storage interface
+    bool Get(const std::string &key, std::string &value, uint32_t *flags = nullptr) override;
+
+    // Implements Afina::Storage interface
+    bool GetRef(const std::string &key, ItemRef &item) override;
+
+    // Implements Afina::Storage interface, keys are prefetched the same way as in SimpleLRU::GetRefs
+    size_t MultiGet(const std::vector<std::string> &keys, std::vector<ItemRef> &items) override;
+
+    /**
+     * Number of bytes an entry with the given key and value sizes takes from the cache
+     * memory limit, including node overhead
+     */
+    static size_t EntrySize(size_t key_size, size_t value_size) {
+        return sizeof(clock_node) + key_size + value_size;
+    }
+
+    // Current number of bytes used by entries
+    inline size_t Size() const { return _size; }
+
+    /**
+     * Deletes at most budget items which expiration time has come. See SimpleLRU::SweepExpired
+     *
+     * @return number of deleted items
+     */
+    size_t SweepExpired(size_t budget);
+
+private:
+    // Cache node, allocated as single block: [clock_node][key bytes][value bytes]
+    struct clock_node {
+        // Cached HashKey(key)
+        uint64_t hash;
+
+        uint32_t key_size;
+        uint32_t value_size;
+
+        // Number of bytes reserved for value
+        uint32_t capacity;
+
+        // Position of the node in the ring
+        uint32_t slot;
+
+        // Unix time node expires at, 0 if never
+        uint32_t expire;
+
+        // Opaque client data, takes padding after expire so doesn't grow the node
+        uint32_t flags;
+
+        // Version of the value, changes on every modification, see Storage::Cas
+        uint64_t cas;
+
+        // Link in the expiration wheel, used only if expire isn't 0
+        TimerHook<clock_node> timer;
+
+        // Node has been read since the hand passed it last time
+        std::atomic<bool> referenced;
+
+        // References held by the ring and by ItemRef handles, see SimpleLRU::lru_node::refs
+        std::atomic<uint32_t> refs;
+
+        inline char *key() { return reinterpret_cast<char *>(this + 1); }
+        inline const char *key() const { return reinterpret_cast<const char *>(this + 1); }
+        inline char *value() { return key() + key_size; }
+        inline const char *value() const { return key() + key_size; }
+
+        // Bytes taken by the node from the cache limit
+        inline size_t size() const { return EntrySize(key_size, capacity); }
+    };
+
+    // Extracts key of the node for the index
+    struct clock_node_key {
+        std::pair<const char *, size_t> operator()(const clock_node &node) const {
+            return std::make_pair(node.key(), node.key_size);
+        }
+    };
+
+    // Allocates new node (not placed anywhere) with the given key and room for capacity bytes of value
+    static clock_node *_AllocNode(const char *key, size_t key_size, uint64_t hash, size_t capacity);
+
+    // Finds node by key, expired node is deleted and not returned
+    clock_node *_FindAlive(const std::string &key, uint64_t hash);
+
+    // GetRef with hash of the key already known
+    bool _GetRef(const std::string &key, uint64_t hash, ItemRef &item);
+
+    // Number of keys MultiGet hashes and prefetches ahead
+    static const size_t kPrefetchBatch = 16;
+
+    // Put new node without searching for key
+    bool _PutNew(const std::string &key, uint64_t hash, const std::string &value, uint32_t expire, uint32_t flags);
+
+    // Set value by node reference
+    bool _Set(clock_node &node, const std::string &value, uint32_t expire, uint32_t flags);
+
+    // Adds data to the value of the node, either at the end or at the beginning
+    bool _Concat(clock_node &node, const std::string &data, bool prepend);
+
+    // Applies incr/decr to the counter stored in the node, rewrites value in place whenever possible.
+    // Returns false if node had to be deleted because new value doesn't fit into the cache
+    bool _AddDelta(clock_node &node, uint64_t delta, bool decrement, uint64_t &result);
+
+    // Moves node into a new block with room for capacity bytes of value, see SimpleLRU::_Reallocate
+    clock_node &_Reallocate(clock_node &node, size_t capacity);
+
+    // Updates node expiration time and its place in the expiration wheel
+    void _SetExpire(clock_node &node, uint32_t expire);
+
+    // Puts node into the free slot of the ring
+    void _Place(clock_node *node);
+
+    // Removes node from the ring and index and drops ring reference to it
+    void _Delete(clock_node &node);
+
+    // Drops one reference to the node, frees it if that was the last one
+    static void _Unref(void *node);
+
+    // Moves clock hand until one node gets evicted
+    void _Evict();
+
+    static inline bool _IsExpired(const clock_node &node, uint32_t now) {
+        return node.expire != 0 && node.expire <= now;
+    }
+
+    // Maximum number of bytes could be stored in this cache, including node headers
+    std::size_t _max_size;
+
+    // Current number of bytes (all nodes, see clock_node::size)
+    std::size_t _size;
+
+    // Ring of nodes, owns all of them. Deleted nodes leave holes (nullptr) that are reused by inserts
+    std::vector<clock_node *> _ring;
+
+    // Holes in the ring
+    std::vector<uint32_t> _free_slots;
+
+    // Clock hand, position in the ring to check next
+    size_t _hand;
+
+    // Nodes with expiration time, by unix time in seconds
+    TimingWheel<clock_node, &clock_node::timer, &clock_node::expire> _expiry;
+
+    // Index of nodes from the ring, allows fast random access to elements by key
+    HashIndex<clock_node, clock_node_key> _index;
+};
+
+} // namespace Backend
+} // namespace Afina
+
+#endif // AFINA_STORAGE_SIMPLE_CLOCK_H
@@ -1,15 +1,58 @@
 #include "SimpleLRU.h"
+#include "Counter.h"
+#include "Version.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <new>
+#include <stdexcept>
 
 namespace Afina {
 namespace Backend {
 
-// void SimpleLRU::_Clear() {
-//    _lru_index.clear();
-//    delete _lru_head.release();
-//    _lru_tail = nullptr;
-//    _size = 0;
-//}
+const size_t SimpleLRU::kPrefetchBatch;
+
+// See SimpleLRU.h
+SimpleLRU::SimpleLRU(size_t max_size, Promotion promotion, std::chrono::milliseconds promotion_interval,
+                     Admission admission)
+    : _max_size(max_size), _size(0), _promotion(promotion), _promotion_interval(promotion_interval.count()),
+      _created(std::chrono::steady_clock::now()), _main{nullptr, nullptr, 0}, _window{nullptr, nullptr, 0},
+      _window_max_size(0), _expiry(std::time(nullptr)) {
+    if (admission == Admission::kTinyLFU) {
+        // 1% of memory for the window, like in W-TinyLFU paper
+        _window_max_size = max_size / 100;
+        _sketch.reset(new FrequencySketch(max_size / 64));
+    }
+}
+
+// See SimpleLRU.h
+SimpleLRU::lru_node *SimpleLRU::_AllocNode(const char *key, size_t key_size, uint64_t hash, size_t capacity) {
+    void *mem = std::malloc(EntrySize(key_size, capacity));
+    if (mem == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    lru_node *node = new (mem) lru_node;
+    node->prev = nullptr;
+    node->next = nullptr;
+    node->hash = hash;
+    node->key_size = key_size;
+    node->value_size = 0;
+    node->cas = 0;
+    node->capacity = capacity;
+    node->promoted_at = 0;
+    node->referenced = false;
+    node->in_window = false;
+    node->refs.store(1, std::memory_order_relaxed);
+    node->expire = 0;
+    node->flags = 0;
+    node->timer.next = nullptr;
+    node->timer.pprev = nullptr;
+    std::memcpy(node->key(), key, key_size);
+    return node;
+}
 
 void SimpleLRU::_ReduceToSize(std::size_t size) {
     while (_size > size) {
@@ -17,172 +60,484 @@ void SimpleLRU::_ReduceToSize(std::size_t size) {
     }
 }
 
-void SimpleLRU::_DeleteFromTail() {
-    lru_node *tmp = _lru_tail;
-    std::size_t del_size = tmp->key.size() + tmp->value.size();
-    lru_node *new_tail = tmp->prev;
-    const std::string &del_key = tmp->key;
-    auto found = _lru_index.find(del_key);
-    _lru_index.erase(found);
-    if (_lru_tail == _lru_head.get()) {
-        _lru_head.reset();
-    } else {
-        tmp->prev->next.reset();
+SimpleLRU::lru_node &SimpleLRU::_Victim(lru_list &list) {
+    // Each second chance clears the mark, so loop ends after at most one pass over the list
+    while (list.tail->referenced) {
+        lru_node &node = *list.tail;
+        node.referenced = false;
+        _MoveToHead(node);
+    }
+    return *list.tail;
+}
+
+void SimpleLRU::_DeleteFromTail() { _Delete(_Victim(_main.tail != nullptr ? _main : _window)); }
+
+void SimpleLRU::_MakeRoomInWindow(std::size_t size) {
+    std::size_t main_max_size = _max_size - _window_max_size;
+    while (_window.tail != nullptr && _window.size + size > _window_max_size) {
+        lru_node &candidate = *_window.tail;
+        _Unlink(candidate);
+
+        // Candidate has to win against every victim it pushes out of the main list
+        uint32_t frequency = _sketch->Estimate(candidate.hash);
+        bool admitted = true;
+        while (_main.tail != nullptr && _main.size + candidate.size() > main_max_size) {
+            lru_node &victim = _Victim(_main);
+            if (frequency <= _sketch->Estimate(victim.hash)) {
+                admitted = false;
+                break;
+            }
+            _Delete(victim);
+        }
+
+        if (admitted) {
+            _LinkToHead(_main, candidate);
+        } else {
+            _Free(candidate);
+        }
     }
-    _size -= del_size;
-    _lru_tail = new_tail;
-    if (_lru_tail != nullptr) {
-        _lru_tail->next = nullptr;
+}
+
+void SimpleLRU::_Delete(lru_node &node) {
+    _Unlink(node);
+    _Free(node);
+}
+
+void SimpleLRU::_Free(lru_node &node) {
+    _lru_index.Erase(&node, node.hash);
+    _expiry.Remove(node);
+    _size -= node.size();
+    _Unref(&node);
+}
+
+void SimpleLRU::_Unref(void *node) {
+    lru_node *p = static_cast<lru_node *>(node);
+    if (p->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        p->~lru_node();
+        std::free(p);
     }
 }
 
-void SimpleLRU::_MoveToHead(std::reference_wrapper<lru_node> ref) {
-    lru_node &node = ref.get();
-    if (_lru_head.get() == &node) {
-        return;
+void SimpleLRU::_Clear() {
+    _lru_index.Clear();
+    _expiry.Clear();
+    for (lru_list *list : {&_main, &_window}) {
+        while (list->head != nullptr) {
+            lru_node *next = list->head->next;
+            _Unref(list->head);
+            list->head = next;
+        }
+        list->tail = nullptr;
+        list->size = 0;
+    }
+    _size = 0;
+}
+
+void SimpleLRU::_LinkToHead(lru_list &list, lru_node &node) {
+    if (_promotion == Promotion::kInterval) {
+        node.promoted_at = _Now();
     }
-    if (_lru_tail == &node) {
-        // our element is in tail, and tail != head
-        _lru_head->prev = &node;
-        _lru_tail = node.prev;
-        node.prev->next.swap(node.next);
-        node.next.swap(_lru_head);
+    node.in_window = (&list == &_window);
+    node.prev = nullptr;
+    node.next = list.head;
+    if (list.head != nullptr) {
+        list.head->prev = &node;
+    } else {
+        list.tail = &node;
+    }
+    list.head = &node;
+    list.size += node.size();
+}
+
+void SimpleLRU::_Unlink(lru_node &node) {
+    lru_list &list = _ListOf(node);
+    if (node.prev != nullptr) {
+        node.prev->next = node.next;
     } else {
-        // our element is not in head or tail
-        _lru_head->prev = &node;
+        list.head = node.next;
+    }
+    if (node.next != nullptr) {
         node.next->prev = node.prev;
-        node.prev->next.swap(node.next);
-        node.next.swap(_lru_head);
+    } else {
+        list.tail = node.prev;
+    }
+    node.prev = nullptr;
+    node.next = nullptr;
+    list.size -= node.size();
+}
+
+void SimpleLRU::_MoveToHead(lru_node &node) {
+    lru_list &list = _ListOf(node);
+    if (list.head == &node) {
+        return;
+    }
+    _Unlink(node);
+    _LinkToHead(list, node);
+}
+
+SimpleLRU::lru_node *SimpleLRU::_FindAlive(const std::string &key, uint64_t hash) {
+    lru_node *found = _lru_index.Find(key.data(), key.size(), hash);
+    if (found != nullptr && found->expire != 0 && _IsExpired(*found, std::time(nullptr))) {
+        _Delete(*found);
+        return nullptr;
     }
-    _lru_head->prev = nullptr;
+    return found;
 }
 
-bool SimpleLRU::_PutNew(const std::string &key, const std::string &value) {
-    std::size_t entry_size = key.size() + value.size();
+bool SimpleLRU::_PutNew(const std::string &key, uint64_t hash, const std::string &value, uint32_t expire,
+                       uint32_t flags) {
+    std::size_t entry_size = EntrySize(key.size(), value.size());
     if (entry_size > _max_size) {
         return false;
     }
-    lru_node *node = new lru_node{key, value, nullptr, nullptr};
-    _ReduceToSize(_max_size - entry_size);
-    if (!_lru_index.empty()) {
-        _lru_head->prev = node;
-        _lru_head.swap(node->next);
-    } else {
-        _lru_tail = node;
+    if (_sketch) {
+        _sketch->Increment(hash);
+        _MakeRoomInWindow(entry_size);
     }
-    _lru_head.reset(node);
-    _lru_index.insert({std::cref(_lru_head->key), std::ref(*node)});
+    _ReduceToSize(_max_size - entry_size);
+
+    lru_node *node = _AllocNode(key.data(), key.size(), hash, value.size());
+    std::memcpy(node->value(), value.data(), value.size());
+    node->value_size = value.size();
+    node->cas = NextVersion();
+    node->flags = flags;
+    _SetExpire(*node, expire);
+    _LinkToHead(_sketch ? _window : _main, *node);
+    _lru_index.Insert(node, hash);
     _size += entry_size;
     return true;
 }
 
-bool SimpleLRU::_Set(std::reference_wrapper<lru_node> ref, const std::string &value) {
+bool SimpleLRU::_Set(lru_node &node, const std::string &value, uint32_t expire, uint32_t flags) {
     std::size_t val_size = value.size();
-    lru_node &node = ref.get();
-    if (node.key.size() + val_size > _max_size) {
+    if (EntrySize(node.key_size, val_size) > _max_size) {
         return false;
     }
-    long size_inc = static_cast<long>(val_size) - static_cast<long>(node.value.size());
-    _MoveToHead(ref);
-    if (size_inc > 0) {
-        _ReduceToSize(_max_size - size_inc);
+    _MoveToHead(node);
+
+    // Value fits into the node and doesn't waste more than a half of it: update in place. Unless somebody
+    // reads the node through ItemRef, new references couldn't appear while we are here
+    if (val_size <= node.capacity && val_size >= node.capacity / 2 && node.refs.load(std::memory_order_acquire) == 1) {
+        std::memcpy(node.value(), value.data(), val_size);
+        node.value_size = val_size;
+        node.cas = NextVersion();
+        node.flags = flags;
+        _SetExpire(node, expire);
+        return true;
     }
-    node.value = value;
-    _size += size_inc;
+
+    // Otherwise node gets reallocated
+    lru_node &new_node = _Reallocate(node, val_size);
+    std::memcpy(new_node.value(), value.data(), val_size);
+    new_node.value_size = val_size;
+    new_node.cas = NextVersion();
+    new_node.flags = flags;
+    _SetExpire(new_node, expire);
+    _Unref(&node);
     return true;
 }
 
-void SimpleLRU::_Get(std::reference_wrapper<lru_node> ref, std::string &value) {
-    _MoveToHead(ref);
-    value = ref.get().value;
+bool SimpleLRU::_Concat(lru_node &node, const std::string &data, bool prepend) {
+    std::size_t val_size = node.value_size + data.size();
+    if (EntrySize(node.key_size, val_size) > _max_size) {
+        return false;
+    }
+    _MoveToHead(node);
+
+    // ItemRef holders see only first value_size bytes, so appending in place is safe even for pinned node
+    if (val_size <= node.capacity && (!prepend || node.refs.load(std::memory_order_acquire) == 1)) {
+        if (prepend) {
+            std::memmove(node.value() + data.size(), node.value(), node.value_size);
+            std::memcpy(node.value(), data.data(), data.size());
+        } else {
+            std::memcpy(node.value() + node.value_size, data.data(), data.size());
+        }
+        node.value_size = val_size;
+        node.cas = NextVersion();
+        return true;
+    }
+
+    // Reserve room for further appends, so that series of small appends costs amortized O(1) per byte
+    std::size_t capacity = std::min(val_size + val_size / 2, _max_size - EntrySize(node.key_size, 0));
+    lru_node &new_node = _Reallocate(node, capacity);
+    char *dst = new_node.value();
+    if (prepend) {
+        std::memcpy(dst, data.data(), data.size());
+        dst += data.size();
+    }
+    std::memcpy(dst, node.value(), node.value_size);
+    if (!prepend) {
+        std::memcpy(dst + node.value_size, data.data(), data.size());
+    }
+    new_node.value_size = val_size;
+    new_node.cas = NextVersion();
+    _Unref(&node);
+    return true;
+}
+
+bool SimpleLRU::_AddDelta(lru_node &node, uint64_t delta, bool decrement, uint64_t &result) {
+    uint64_t value;
+    if (!ParseCounter(node.value(), node.value_size, value)) {
+        throw std::invalid_argument("cannot increment or decrement non-numeric value");
+    }
+    result = ApplyDelta(value, delta, decrement);
+    _MoveToHead(node);
+
+    char digits[kCounterDigits];
+    size_t size = FormatCounter(result, digits);
+    lru_node *target = &node;
+    if (size > node.capacity || node.refs.load(std::memory_order_acquire) != 1) {
+        // Reserve room for any counter value, so that node is reallocated at most once
+        size_t capacity = std::min(std::max<size_t>(node.capacity, kCounterDigits),
+                                   _max_size - EntrySize(node.key_size, 0));
+        if (capacity < size) {
+            // Counter doesn't fit into the cache anymore, just like too big value
+            _Delete(node);
+            return false;
+        }
+        target = &_Reallocate(node, capacity);
+        _Unref(&node);
+    }
+    std::memcpy(target->value(), digits, size);
+    target->value_size = size;
+    target->cas = NextVersion();
+    return true;
+}
+
+SimpleLRU::lru_node &SimpleLRU::_Reallocate(lru_node &node, size_t capacity) {
+    // Take node out of the list first, so that it couldn't be choosen for eviction while we are making
+    // room for the new one
+    std::size_t new_size = EntrySize(node.key_size, capacity);
+    lru_list &list = _ListOf(node);
+    _Unlink(node);
+    _size -= node.size();
+    _ReduceToSize(_max_size - new_size);
+
+    lru_node *new_node = _AllocNode(node.key(), node.key_size, node.hash, capacity);
+    new_node->flags = node.flags;
+    uint32_t expire = node.expire;
+    _expiry.Remove(node);
+    _SetExpire(*new_node, expire);
+    _lru_index.Replace(&node, new_node, node.hash);
+    _LinkToHead(list, *new_node);
+    _size += new_size;
+    return *new_node;
+}
+
+void SimpleLRU::_SetExpire(lru_node &node, uint32_t expire) {
+    if (node.expire == expire && (expire == 0 || _expiry.Scheduled(node))) {
+        return;
+    }
+    _expiry.Remove(node);
+    node.expire = expire;
+    if (expire != 0) {
+        _expiry.Add(node);
+    }
+}
+
+void SimpleLRU::_Hit(lru_node &node) {
+    switch (_promotion) {
+    case Promotion::kAlways:
+        _MoveToHead(node);
+        break;
+    case Promotion::kInterval:
+        if (uint32_t(_Now() - node.promoted_at) >= _promotion_interval) {
+            _MoveToHead(node);
+        }
+        break;
+    case Promotion::kMark:
+        if (!node.referenced) {
+            node.referenced = true;
+        }
+        break;
+    }
 }
 
 // See MapBasedGlobalLockImpl.h
-bool SimpleLRU::Put(const std::string &key, const std::string &value) {
-    auto found = _lru_index.find(key);
-    if (found != _lru_index.end()) {
-        return _Set(found->second, value);
+bool SimpleLRU::Put(const std::string &key, const std::string &value, uint32_t expire, uint32_t flags) {
+    uint64_t hash = HashKey(key);
+    lru_node *found = _FindAlive(key, hash);
+    if (found != nullptr) {
+        return _Set(*found, value, expire, flags);
     }
-    return _PutNew(key, value);
+    return _PutNew(key, hash, value, expire, flags);
 }
 
 // See MapBasedGlobalLockImpl.h
-bool SimpleLRU::PutIfAbsent(const std::string &key, const std::string &value) {
-    if (_lru_index.find(key) != _lru_index.end()) {
+bool SimpleLRU::PutIfAbsent(const std::string &key, const std::string &value, uint32_t expire, uint32_t flags) {
+    uint64_t hash = HashKey(key);
+    if (_FindAlive(key, hash) != nullptr) {
         return false;
     }
-    return _PutNew(key, value);
+    return _PutNew(key, hash, value, expire, flags);
 }
 
 // See MapBasedGlobalLockImpl.h
-bool SimpleLRU::Set(const std::string &key, const std::string &value) {
-    auto found = _lru_index.find(key);
-    if (found == _lru_index.end()) {
+bool SimpleLRU::Set(const std::string &key, const std::string &value, uint32_t expire, uint32_t flags) {
+    lru_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    return _Set(*found, value, expire, flags);
+}
+
+// See SimpleLRU.h
+Storage::CasResult SimpleLRU::Cas(const std::string &key, const std::string &value, uint64_t cas, uint32_t expire,
+                                 uint32_t flags) {
+    lru_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return CasResult::kNotFound;
+    }
+    if (found->cas != cas) {
+        return CasResult::kExists;
+    }
+    return _Set(*found, value, expire, flags) ? CasResult::kStored : CasResult::kNotStored;
+}
+
+// See SimpleLRU.h
+bool SimpleLRU::Append(const std::string &key, const std::string &data) {
+    lru_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    return _Concat(*found, data, false);
+}
+
+// See SimpleLRU.h
+bool SimpleLRU::Prepend(const std::string &key, const std::string &data) {
+    lru_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    return _Concat(*found, data, true);
+}
+
+// See SimpleLRU.h
+bool SimpleLRU::Incr(const std::string &key, uint64_t delta, uint64_t &result) {
+    lru_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
+        return false;
+    }
+    return _AddDelta(*found, delta, false, result);
+}
+
+// See SimpleLRU.h
+bool SimpleLRU::Decr(const std::string &key, uint64_t delta, uint64_t &result) {
+    lru_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
         return false;
     }
-    return _Set(found->second, value);
+    return _AddDelta(*found, delta, true, result);
 }
 
 // See MapBasedGlobalLockImpl.h
 bool SimpleLRU::Delete(const std::string &key) {
-    auto found = _lru_index.find(key);
-    if (found == _lru_index.end()) {
+    lru_node *found = _FindAlive(key, HashKey(key));
+    if (found == nullptr) {
         return false;
     }
-    std::reference_wrapper<lru_node> ref = found->second;
-    lru_node &node = ref.get();
-    std::size_t del_size = key.size() + node.value.size();
-    lru_node *tmp = &node;
-    _lru_index.erase(found);
-    if (_lru_head.get() == tmp) {
-        _lru_head.swap(tmp->next);
-        _lru_head->prev = nullptr;
-        if (_lru_head.get() == _lru_tail) {
-            _lru_tail = nullptr;
-        }
-    } else if (_lru_tail == tmp) {
-        tmp->prev->next.swap(tmp->next);
-        _lru_tail = tmp->prev;
-    } else {
-        tmp->next->prev = tmp->prev;
-        tmp->prev->next.swap(tmp->next);
-    }
-    tmp->next.reset();
-    _size -= del_size;
+    _Delete(*found);
     return true;
 }
 
 // See MapBasedGlobalLockImpl.h
-bool SimpleLRU::Get(const std::string &key, std::string &value) {
-    auto found = _lru_index.find(key);
-    if (found == _lru_index.end()) {
+bool SimpleLRU::Get(const std::string &key, std::string &value, uint32_t *flags) {
+    uint64_t hash = HashKey(key);
+    if (_sketch) {
+        _sketch->Increment(hash);
+    }
+    lru_node *found = _FindAlive(key, hash);
+    if (found == nullptr) {
         return false;
     }
-    _Get(found->second, value);
+    _Hit(*found);
+    value.assign(found->value(), found->value_size);
+    if (flags != nullptr) {
+        *flags = found->flags;
+    }
     return true;
 }
 
+// See SimpleLRU.h
+bool SimpleLRU::GetRef(const std::string &key, ItemRef &item) { return _GetRef(key, HashKey(key), item); }
+
+// See SimpleLRU.h
+size_t SimpleLRU::MultiGet(const std::vector<std::string> &keys, std::vector<ItemRef> &items) {
+    items.clear();
+    items.resize(keys.size());
+    size_t found = 0;
+    uint32_t positions[kPrefetchBatch];
+    for (size_t i = 0; i < keys.size(); i += kPrefetchBatch) {
+        size_t n = std::min(kPrefetchBatch, keys.size() - i);
+        for (size_t j = 0; j < n; j++) {
+            positions[j] = i + j;
+        }
+        found += GetRefs(keys, positions, n, items);
+    }
+    return found;
+}
+
+// See SimpleLRU.h
+size_t SimpleLRU::GetRefs(const std::vector<std::string> &keys, const uint32_t *positions, size_t n,
+                          std::vector<ItemRef> &items) {
+    size_t found = 0;
+    uint64_t hashes[kPrefetchBatch];
+    for (size_t i = 0; i < n; i += kPrefetchBatch) {
+        size_t batch = std::min(kPrefetchBatch, n - i);
+        for (size_t j = 0; j < batch; j++) {
+            hashes[j] = HashKey(keys[positions[i + j]]);
+            _lru_index.Prefetch(hashes[j]);
+        }
+        for (size_t j = 0; j < batch; j++) {
+            uint32_t pos = positions[i + j];
+            if (_GetRef(keys[pos], hashes[j], items[pos])) {
+                found++;
+            }
+        }
+    }
+    return found;
+}
+
+bool SimpleLRU::_GetRef(const std::string &key, uint64_t hash, ItemRef &item) {
+    if (_sketch) {
+        _sketch->Increment(hash);
+    }
+    lru_node *found = _FindAlive(key, hash);
+    if (found == nullptr) {
+        return false;
+    }
+    _Hit(*found);
+    found->refs.fetch_add(1, std::memory_order_relaxed);
+    item = ItemRef(found->value(), found->value_size, found->flags, found->cas, found, &SimpleLRU::_Unref);
+    return true;
+}
+
+// See SimpleLRU.h
+size_t SimpleLRU::SweepExpired(size_t budget) {
+    return _expiry.Advance(std::time(nullptr), [this](lru_node &node) { _Delete(node); }, budget);
+}
+
 void SimpleLRU::_PrintDebug(std::ostream &os) {
     os << "\tindex:\n";
-    for (auto &pair : _lru_index) {
-        os << "(" << pair.first.get() << ")\n";
-    }
+    _lru_index.ForEach(
+        [&os](const lru_node *node) { os << "(" << std::string(node->key(), node->key_size) << ")\n"; });
     os << "\t</index>\n";
-    lru_node *tmp = _lru_head.get();
-    os << "\tLIST:"
-       << "\n";
-    while (tmp != nullptr) {
-        os << tmp->key << " " << tmp->value << " " << ((tmp->next != nullptr) ? "_" : "0") << " "
-           << ((tmp->prev != nullptr) ? "_" : "0") << " //\n";
-        tmp = tmp->next.get();
-    }
-    os << "  REVERSE:"
-       << "\n";
-    tmp = _lru_tail;
-    while (tmp != nullptr) {
-        os << tmp->key << " " << tmp->value << " " << ((tmp->next != nullptr) ? "_" : "0") << " "
-           << ((tmp->prev != nullptr) ? "_" : "0") << " \\\\\n";
-        tmp = tmp->prev;
+    for (lru_list *list : {&_window, &_main}) {
+        lru_node *tmp = list->head;
+        os << "\tLIST" << (list == &_window ? " (window):" : ":") << "\n";
+        while (tmp != nullptr) {
+            os << std::string(tmp->key(), tmp->key_size) << " " << std::string(tmp->value(), tmp->value_size) << " "
+               << ((tmp->next != nullptr) ? "_" : "0") << " " << ((tmp->prev != nullptr) ? "_" : "0") << " //\n";
+            tmp = tmp->next;
+        }
+        os << "  REVERSE:"
+           << "\n";
+        tmp = list->tail;
+        while (tmp != nullptr) {
+            os << std::string(tmp->key(), tmp->key_size) << " " << std::string(tmp->value(), tmp->value_size) << " "
+               << ((tmp->next != nullptr) ? "_" : "0") << " " << ((tmp->prev != nullptr) ? "_" : "0") << " \\\\\n";
+            tmp = tmp->prev;
+        }
     }
     os << "\t</LIST>"
        << "\n";
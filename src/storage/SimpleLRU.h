@@ -1,89 +1,319 @@
 #ifndef AFINA_STORAGE_SIMPLE_LRU_H
 #define AFINA_STORAGE_SIMPLE_LRU_H
 
-#include <map>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include <afina/Storage.h>
+#include <afina/TimingWheel.h>
+
+#include "FrequencySketch.h"
+#include "HashIndex.h"
 
 namespace Afina {
 namespace Backend {
 
 /**
- * # Map based implementation
+ * # Hash index based implementation
  * That is NOT thread safe implementaiton!!
  */
 class SimpleLRU : public Afina::Storage {
 public:
-    SimpleLRU(size_t max_size = 1024) : _max_size(max_size), _size(0) {}
+    /**
+     * What cache does with an item on GET hit
+     */
+    enum class Promotion {
+        // Move item to the head of the list on every hit, classic LRU
+        kAlways,
+
+        // Move item to the head only if it wasn't moved there during the last promotion interval,
+        // all other hits don't write anything
+        kInterval,
+
+        // Hit only marks item as referenced. Marked item reaching the tail gets a second chance and
+        // is moved to the head instead of being evicted
+        kMark
+    };
+
+    /**
+     * Which new items are allowed to push out existing ones
+     */
+    enum class Admission {
+        // Any, new item always evicts the tail
+        kNone,
+
+        // W-TinyLFU: new items are placed into a small window LRU. Item leaving the window gets into
+        // the main LRU only if it is estimated to be accessed more frequently than main LRU victim.
+        // So single scan over many keys flushes only the window, not the hot items.
+        kTinyLFU
+    };
+
+    SimpleLRU(size_t max_size = 1024, Promotion promotion = Promotion::kAlways,
+              std::chrono::milliseconds promotion_interval = std::chrono::milliseconds{60000},
+              Admission admission = Admission::kNone);
+
+    ~SimpleLRU() override { _Clear(); }
 
-    ~SimpleLRU() override { _ReduceToSize(0); }
+    // Implements Afina::Storage interface
+    bool Put(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    bool PutIfAbsent(const std::string &key, const std::string &value, uint32_t expire = 0,
+                     uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    bool Set(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    CasResult Cas(const std::string &key, const std::string &value, uint64_t cas, uint32_t expire = 0,
+                  uint32_t flags = 0) override;
+
+    // Implements Afina::Storage interface
+    bool Append(const std::string &key, const std::string &data) override;
 
     // Implements Afina::Storage interface
-    bool Put(const std::string &key, const std::string &value) override;
+    bool Prepend(const std::string &key, const std::string &data) override;
 
     // Implements Afina::Storage interface
-    bool PutIfAbsent(const std::string &key, const std::string &value) override;
+    bool Incr(const std::string &key, uint64_t delta, uint64_t &result) override;
 
     // Implements Afina::Storage interface
-    bool Set(const std::string &key, const std::string &value) override;
+    bool Decr(const std::string &key, uint64_t delta, uint64_t &result) override;
 
     // Implements Afina::Storage interface
     bool Delete(const std::string &key) override;
 
     // Implements Afina::Storage interface
-    bool Get(const std::string &key, std::string &value) override;
+    bool Get(const std::string &key, std::string &value, uint32_t *flags = nullptr) override;
+
+    // Implements Afina::Storage interface
+    bool GetRef(const std::string &key, ItemRef &item) override;
+
+    // Implements Afina::Storage interface
+    size_t MultiGet(const std::vector<std::string> &keys, std::vector<ItemRef> &items) override;
+
+    /**
+     * Building block of MultiGet: resolves keys[positions[i]] into items[positions[i]] for i in [0, n).
+     * Keys are hashed and their index slots prefetched by batches, so that cache misses of different
+     * keys overlap instead of being paid one after another. items must have room for all positions
+     *
+     * @return number of found keys
+     */
+    size_t GetRefs(const std::vector<std::string> &keys, const uint32_t *positions, size_t n,
+                   std::vector<ItemRef> &items);
+
+    /**
+     * Number of bytes an entry with the given key and value sizes takes from the cache
+     * memory limit, including node overhead
+     */
+    static size_t EntrySize(size_t key_size, size_t value_size) { return sizeof(lru_node) + key_size + value_size; }
+
+    // Current number of bytes used by entries
+    inline size_t Size() const { return _size; }
+
+    /**
+     * Expired items are deleted lazily once somebody looks them up, so items nobody asks for would
+     * occupy memory until LRU evicts them. This method deletes at most budget items which expiration
+     * time has come, items are found using the timing wheel, so cost doesn't depend on number of live
+     * items. Call it periodically to keep memory for live items.
+     *
+     * @return number of deleted items
+     */
+    size_t SweepExpired(size_t budget);
 
     // For debugging: prints index and list data for manual integrity checking
     void _PrintDebug(std::ostream &os);
 
 private:
-    // LRU cache node
+    // LRU cache node. Header, key and value are allocated in one memory block:
+    // [lru_node][key bytes][value bytes + unused capacity]
     struct lru_node {
-        const std::string key;
-        std::string value;
         lru_node *prev;
-        std::unique_ptr<lru_node> next;
+        lru_node *next;
+
+        // Cached HashKey(key)
+        uint64_t hash;
+
+        uint32_t key_size;
+        uint32_t value_size;
+
+        // Number of bytes reserved for value
+        uint32_t capacity;
+
+        // Time node was moved to the head last time, see _Now()
+        uint32_t promoted_at;
+
+        // Unix time node expires at, 0 if never
+        uint32_t expire;
+
+        // Opaque client data, takes padding after expire so doesn't grow the node
+        uint32_t flags;
+
+        // Version of the value, changes on every modification, see Storage::Cas
+        uint64_t cas;
+
+        // Link in the expiration wheel, used only if expire isn't 0
+        TimerHook<lru_node> timer;
+
+        // Node was hit since it has been moved to the head, used by Promotion::kMark
+        bool referenced;
+
+        // Node belongs to the window list, used by Admission::kTinyLFU
+        bool in_window;
+
+        // One reference is held by the cache while node is in it, others by ItemRef handles. Node
+        // memory gets freed once the last one is dropped
+        std::atomic<uint32_t> refs;
+
+        inline char *key() { return reinterpret_cast<char *>(this + 1); }
+        inline const char *key() const { return reinterpret_cast<const char *>(this + 1); }
+        inline char *value() { return key() + key_size; }
+        inline const char *value() const { return key() + key_size; }
+
+        // Bytes taken by the node from the cache limit
+        inline size_t size() const { return EntrySize(key_size, capacity); }
     };
     using lru_node = struct lru_node;
 
+    // Doubly linked list of nodes, elements are ordered descending by "freshness": in the tail
+    // element that wasn't used for longest time
+    struct lru_list {
+        lru_node *head;
+        lru_node *tail;
+
+        // Bytes taken by nodes of the list
+        std::size_t size;
+    };
+
+    // Extracts key of the node for the index
+    struct lru_node_key {
+        std::pair<const char *, size_t> operator()(const lru_node &node) const {
+            return std::make_pair(node.key(), node.key_size);
+        }
+    };
+
+    // Allocates new node (not linked anywhere) with the given key and room for capacity bytes of value
+    static lru_node *_AllocNode(const char *key, size_t key_size, uint64_t hash, size_t capacity);
+
+    // Finds node by key, expired node is deleted and not returned
+    lru_node *_FindAlive(const std::string &key, uint64_t hash);
+
     // Put new node without searching for key
-    bool _PutNew(const std::string &key, const std::string &value);
+    bool _PutNew(const std::string &key, uint64_t hash, const std::string &value, uint32_t expire, uint32_t flags);
+
+    // Applies promotion policy to the node being read
+    void _Hit(lru_node &node);
 
-    // Get value by node reference
-    void _Get(std::reference_wrapper<lru_node> ref, std::string &value);
+    // GetRef with hash of the key already known
+    bool _GetRef(const std::string &key, uint64_t hash, ItemRef &item);
+
+    // Number of keys GetRefs hashes and prefetches ahead
+    static const size_t kPrefetchBatch = 16;
 
     // Set value by node reference
-    bool _Set(std::reference_wrapper<lru_node> ref, const std::string &value);
+    bool _Set(lru_node &node, const std::string &value, uint32_t expire, uint32_t flags);
+
+    // Adds data to the value of the node, either at the end or at the beginning
+    bool _Concat(lru_node &node, const std::string &data, bool prepend);
+
+    // Applies incr/decr to the counter stored in the node, rewrites value in place whenever possible.
+    // Returns false if node had to be deleted because new value doesn't fit into the cache
+    bool _AddDelta(lru_node &node, uint64_t delta, bool decrement, uint64_t &result);
+
+    // Moves node into a new block with room for capacity bytes of value. New node takes place of the old one
+    // in the list, index and expiration wheel, keeps its flags but value isn't copied. Old node is detached,
+    // caller copies whatever it needs from it and then drops it with _Unref
+    lru_node &_Reallocate(lru_node &node, size_t capacity);
+
+    // Updates node expiration time and its place in the expiration wheel
+    void _SetExpire(lru_node &node, uint32_t expire);
 
     // Delete elements from tail while cache size > specified size
     void _ReduceToSize(std::size_t size);
 
-    // Delete last element
+    // Delete last element of the main list (or of the window if main is empty), elements marked as
+    // referenced get second chance and moved to head instead
     void _DeleteFromTail();
 
-    // Move element to head
-    void _MoveToHead(std::reference_wrapper<lru_node> ref);
+    // Makes room in the window for a new node of the given size. Nodes pushed out of the window
+    // either get into the main list or evicted, see Admission::kTinyLFU
+    void _MakeRoomInWindow(std::size_t size);
+
+    // Returns node to be evicted from the given non empty list, applies second chance if needed
+    lru_node &_Victim(lru_list &list);
+
+    // Removes node from the list and index and frees it
+    void _Delete(lru_node &node);
+
+    // Removes already unlinked node from index and drops cache reference to it
+    void _Free(lru_node &node);
+
+    // Drops one reference to the node, frees it if that was the last one. Called by ItemRef as well,
+    // so could be called without any lock
+    static void _Unref(void *node);
+
+    // Frees all nodes
+    void _Clear();
+
+    // List node belongs to
+    inline lru_list &_ListOf(const lru_node &node) { return node.in_window ? _window : _main; }
+
+    // Move element to head of its list
+    void _MoveToHead(lru_node &node);
+
+    // Links node into the head of the list
+    void _LinkToHead(lru_list &list, lru_node &node);
+
+    // Unlinks node from its list
+    void _Unlink(lru_node &node);
+
+    static inline bool _IsExpired(const lru_node &node, uint32_t now) { return node.expire != 0 && node.expire <= now; }
+
+    // Milliseconds since cache creation, wraps around
+    inline uint32_t _Now() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _created)
+            .count();
+    }
 
     // Maximum number of bytes could be stored in this cache.
-    // i.e all (keys+values) must be less the _max_size
+    // i.e all nodes including headers must be less the _max_size
     std::size_t _max_size;
 
-    // Current number of bytes (all (keys+values))
+    // Current number of bytes (all nodes, see lru_node::size)
     std::size_t _size;
 
-    // Main storage of lru_nodes, elements in this list ordered descending by "freshness": in the head
-    // element that wasn't used for longest time.
-    //
-    // List owns all nodes
-    std::unique_ptr<lru_node> _lru_head;
-    lru_node *_lru_tail;
+    // What to do on hit
+    const Promotion _promotion;
+
+    // Milliseconds, see Promotion::kInterval
+    const uint32_t _promotion_interval;
+
+    // Reference point for node timestamps
+    const std::chrono::steady_clock::time_point _created;
+
+    // Main storage of lru_nodes. Lists own all nodes
+    lru_list _main;
+
+    // Admission window, always empty if admission is disabled
+    lru_list _window;
+
+    // Maximum number of bytes in the window
+    std::size_t _window_max_size;
+
+    // Access frequencies, exists only if Admission::kTinyLFU is used
+    std::unique_ptr<FrequencySketch> _sketch;
+
+    // Nodes with expiration time, by unix time in seconds
+    TimingWheel<lru_node, &lru_node::timer, &lru_node::expire> _expiry;
 
-    // Index of nodes from list above, allows fast random access to elements by lru_node#key
-    std::map<std::reference_wrapper<const std::string>, std::reference_wrapper<lru_node>, std::less<std::string>>
-        _lru_index;
+    // Index of nodes from lists above, allows fast random access to elements by lru_node#key
+    HashIndex<lru_node, lru_node_key> _lru_index;
 };
 
 } // namespace Backend
@@ -0,0 +1,120 @@
+#ifndef AFINA_STORAGE_THREAD_SAFE_SIMPLE_CLOCK_H
+#define AFINA_STORAGE_THREAD_SAFE_SIMPLE_CLOCK_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "SimpleClock.h"
+#include "ExpirySweeper.h"
+
+namespace Afina {
+namespace Backend {
+
+/**
+ * # SimpleClock thread safe version
+ *
+ *
+ */
+class ThreadSafeSimpleClock : public SimpleClock {
+public:
+    ThreadSafeSimpleClock(size_t max_size = 1024) : SimpleClock(max_size), _sweeper([this] { _Sweep(); }) {}
+    ~ThreadSafeSimpleClock() override {}
+
+    // Starts background sweeping of expired items
+    void Start() override { _sweeper.Start(); }
+
+    // Stops background sweeping
+    void Stop() override { _sweeper.Stop(); }
+
+    // see SimpleClock.h
+    bool Put(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::Put(key, value, expire, flags);
+    }
+
+    // see SimpleClock.h
+    bool PutIfAbsent(const std::string &key, const std::string &value, uint32_t expire = 0,
+                     uint32_t flags = 0) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::PutIfAbsent(key, value, expire, flags);
+    }
+
+    // see SimpleClock.h
+    bool Set(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::Set(key, value, expire, flags);
+    }
+
+    // see SimpleClock.h
+    CasResult Cas(const std::string &key, const std::string &value, uint64_t cas, uint32_t expire = 0,
+                  uint32_t flags = 0) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::Cas(key, value, cas, expire, flags);
+    }
+
+    // see SimpleClock.h
+    bool Append(const std::string &key, const std::string &data) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::Append(key, data);
+    }
+
+    // see SimpleClock.h
+    bool Prepend(const std::string &key, const std::string &data) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::Prepend(key, data);
+    }
+
+    // see SimpleClock.h
+    bool Incr(const std::string &key, uint64_t delta, uint64_t &result) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::Incr(key, delta, result);
+    }
+
+    // see SimpleClock.h
+    bool Decr(const std::string &key, uint64_t delta, uint64_t &result) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::Decr(key, delta, result);
+    }
+
+    // see SimpleClock.h
+    bool Delete(const std::string &key) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::Delete(key);
+    }
+
+    // see SimpleClock.h
+    bool Get(const std::string &key, std::string &value, uint32_t *flags = nullptr) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::Get(key, value, flags);
+    }
+
+    // see SimpleClock.h
+    bool GetRef(const std::string &key, ItemRef &item) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::GetRef(key, item);
+    }
+
+    // see SimpleClock.h, all keys are resolved under one lock acquisition
+    size_t MultiGet(const std::vector<std::string> &keys, std::vector<ItemRef> &items) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleClock::MultiGet(keys, items);
+    }
+
+private:
+    // Sweeps expired items, one batch under the lock
+    void _Sweep() {
+        std::unique_lock<std::mutex> lock(_m);
+        SimpleClock::SweepExpired(ExpirySweeper::kBatch);
+    }
+
+    mutable std::mutex _m;
+
+    // Declared last so that its thread is stopped before the rest of the storage is destroyed
+    ExpirySweeper _sweeper;
+};
+
+} // namespace Backend
+} // namespace Afina
+
+#endif // AFINA_STORAGE_THREAD_SAFE_SIMPLE_CLOCK_H
@@ -2,10 +2,12 @@
 #define AFINA_STORAGE_THREAD_SAFE_SIMPLE_LRU_H
 
 #include <map>
+#include <cstdint>
 #include <mutex>
 #include <string>
 
 #include "SimpleLRU.h"
+#include "ExpirySweeper.h"
 
 namespace Afina {
 namespace Backend {
@@ -17,25 +19,66 @@ namespace Backend {
  */
 class ThreadSafeSimplLRU : public SimpleLRU {
 public:
-    ThreadSafeSimplLRU(size_t max_size = 1024) : SimpleLRU(max_size) {}
+    ThreadSafeSimplLRU(size_t max_size = 1024, Promotion promotion = Promotion::kAlways,
+                       std::chrono::milliseconds promotion_interval = std::chrono::milliseconds{60000},
+                       Admission admission = Admission::kNone)
+        : SimpleLRU(max_size, promotion, promotion_interval, admission), _sweeper([this] { _Sweep(); }) {}
     ~ThreadSafeSimplLRU() override {}
 
+    // Starts background sweeping of expired items
+    void Start() override { _sweeper.Start(); }
+
+    // Stops background sweeping
+    void Stop() override { _sweeper.Stop(); }
+
     // see SimpleLRU.h
-    bool Put(const std::string &key, const std::string &value) override {
+    bool Put(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override {
         std::unique_lock<std::mutex> lock(_m);
-        return SimpleLRU::Put(key, value);
+        return SimpleLRU::Put(key, value, expire, flags);
     }
 
     // see SimpleLRU.h
-    bool PutIfAbsent(const std::string &key, const std::string &value) override {
+    bool PutIfAbsent(const std::string &key, const std::string &value, uint32_t expire = 0,
+                     uint32_t flags = 0) override {
         std::unique_lock<std::mutex> lock(_m);
-        return SimpleLRU::PutIfAbsent(key, value);
+        return SimpleLRU::PutIfAbsent(key, value, expire, flags);
     }
 
     // see SimpleLRU.h
-    bool Set(const std::string &key, const std::string &value) override {
+    bool Set(const std::string &key, const std::string &value, uint32_t expire = 0, uint32_t flags = 0) override {
         std::unique_lock<std::mutex> lock(_m);
-        return SimpleLRU::Set(key, value);
+        return SimpleLRU::Set(key, value, expire, flags);
+    }
+
+    // see SimpleLRU.h
+    CasResult Cas(const std::string &key, const std::string &value, uint64_t cas, uint32_t expire = 0,
+                  uint32_t flags = 0) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleLRU::Cas(key, value, cas, expire, flags);
+    }
+
+    // see SimpleLRU.h
+    bool Append(const std::string &key, const std::string &data) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleLRU::Append(key, data);
+    }
+
+    // see SimpleLRU.h
+    bool Prepend(const std::string &key, const std::string &data) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleLRU::Prepend(key, data);
+    }
+
+    // see SimpleLRU.h
+    bool Incr(const std::string &key, uint64_t delta, uint64_t &result) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleLRU::Incr(key, delta, result);
+    }
+
+    // see SimpleLRU.h
+    bool Decr(const std::string &key, uint64_t delta, uint64_t &result) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleLRU::Decr(key, delta, result);
     }
 
     // see SimpleLRU.h
@@ -45,13 +88,34 @@ public:
     }
 
     // see SimpleLRU.h
-    bool Get(const std::string &key, std::string &value) override {
+    bool Get(const std::string &key, std::string &value, uint32_t *flags = nullptr) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleLRU::Get(key, value, flags);
+    }
+
+    // see SimpleLRU.h
+    bool GetRef(const std::string &key, ItemRef &item) override {
+        std::unique_lock<std::mutex> lock(_m);
+        return SimpleLRU::GetRef(key, item);
+    }
+
+    // see SimpleLRU.h, all keys are resolved under one lock acquisition
+    size_t MultiGet(const std::vector<std::string> &keys, std::vector<ItemRef> &items) override {
         std::unique_lock<std::mutex> lock(_m);
-        return SimpleLRU::Get(key, value);
+        return SimpleLRU::MultiGet(keys, items);
     }
 
 private:
+    // Sweeps expired items, one batch under the lock
+    void _Sweep() {
+        std::unique_lock<std::mutex> lock(_m);
+        SimpleLRU::SweepExpired(ExpirySweeper::kBatch);
+    }
+
     mutable std::mutex _m;
+
+    // Declared last so that its thread is stopped before the rest of the storage is destroyed
+    ExpirySweeper _sweeper;
 };
 
 } // namespace Backend
@@ -0,0 +1,24 @@
+#ifndef AFINA_STORAGE_VERSION_H
+#define AFINA_STORAGE_VERSION_H
+
+#include <cstdint>
+
+#include <afina/concurrency/IdAllocator.h>
+
+namespace Afina {
+namespace Backend {
+
+/**
+ * Gives out version for the new value, see Storage::Cas. Versions are unique across all storages of the
+ * process, so ShardedLRU shards never give the same version to different items. Workers take versions by
+ * per thread blocks and don't share a counter on every write
+ */
+inline uint64_t NextVersion() {
+    static Concurrency::IdAllocator versions;
+    return versions.Next();
+}
+
+} // namespace Backend
+} // namespace Afina
+
+#endif // AFINA_STORAGE_VERSION_H
@@ -0,0 +1,43 @@
+#include "gtest/gtest.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <afina/concurrency/CoreLocal.h>
+
+using namespace Afina::Concurrency;
+using namespace std;
+
+TEST(CoreLocalTest, CurrentCpu) {
+    CoreLocal<int> local;
+    EXPECT_LE(1, local.size());
+    EXPECT_EQ(sched_getcpu() % local.size(), CurrentCpu() % local.size());
+
+    // Slots don't share cache lines
+    for (size_t i = 0; i < local.size(); i++) {
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(&local[i]) % kCacheLine);
+        EXPECT_EQ(0, local[i]);
+    }
+}
+
+TEST(CoreLocalTest, Fold) {
+    CoreLocal<atomic<uint64_t>> counter;
+    const size_t kThreads = 8;
+    const size_t kIncrements = 100000;
+
+    vector<thread> threads;
+    for (size_t i = 0; i < kThreads; i++) {
+        threads.emplace_back([&counter] {
+            for (size_t j = 0; j < kIncrements; j++) {
+                counter->fetch_add(1, memory_order_relaxed);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    uint64_t sum = counter.Fold(uint64_t(0), [](uint64_t r, const atomic<uint64_t> &v) { return r + v.load(); });
+    EXPECT_EQ(kThreads * kIncrements, sum);
+}
@@ -0,0 +1,98 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <afina/concurrency/CoreLocal.h>
+#include <afina/concurrency/ThreadLocal.h>
+
+using namespace Afina::Concurrency;
+
+// Compares statistics counter kept in the single shared atomic against per thread (ThreadLocal) and per CPU
+// (CoreLocal) counters. Each thread increments the counter, total is read once all threads are done.
+//
+// Usage: runCounterBenchmark [number of threads...], by default 1, 2, 4, 8, 16 and 32 threads are measured
+
+namespace {
+
+const size_t kIncrementsPerThread = 5000000;
+
+// Runs increment on n threads, returns millions of increments per second done by all of them together
+template <typename F, typename S> double measure(size_t n_threads, F increment, S sum) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < n_threads; i++) {
+        threads.emplace_back([&increment] {
+            for (size_t j = 0; j < kIncrementsPerThread; j++) {
+                increment();
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (sum() != n_threads * kIncrementsPerThread) {
+        std::cerr << "Lost increments: " << sum() << " of " << n_threads * kIncrementsPerThread << std::endl;
+        std::exit(1);
+    }
+    return n_threads * kIncrementsPerThread / std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+void run(size_t n_threads) {
+    std::atomic<uint64_t> shared(0);
+    double atomic_rate = measure(n_threads, [&shared] { shared.fetch_add(1, std::memory_order_relaxed); },
+                                 [&shared] { return shared.load(); });
+
+    // Only the owner thread writes its counter, so plain load and store are enough. Values of exited threads
+    // are gone, so they flush into total on exit
+    std::atomic<uint64_t> total(0);
+    struct flushed {
+        flushed(std::atomic<uint64_t> &total) : total(total), value(0) {}
+        ~flushed() { total += value.load(); }
+
+        std::atomic<uint64_t> &total;
+        std::atomic<uint64_t> value;
+    };
+    double thread_rate;
+    {
+        ThreadLocal<flushed> local([&total] { return new flushed(total); });
+        thread_rate = measure(n_threads,
+                              [&local] {
+                                  auto &v = local->value;
+                                  v.store(v.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                              },
+                              [&total] { return total.load(); });
+    }
+
+    CoreLocal<std::atomic<uint64_t>> core;
+    double core_rate = measure(n_threads, [&core] { core->fetch_add(1, std::memory_order_relaxed); },
+                               [&core] {
+                                   return core.Fold(uint64_t(0), [](uint64_t r, const std::atomic<uint64_t> &v) {
+                                       return r + v.load();
+                                   });
+                               });
+
+    std::cout << n_threads << " threads: atomic " << atomic_rate << " M ops/s, ThreadLocal " << thread_rate
+              << " M ops/s, CoreLocal " << core_rate << " M ops/s" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    std::vector<size_t> threads;
+    for (int i = 1; i < argc; i++) {
+        threads.push_back(std::strtoull(argv[i], nullptr, 10));
+    }
+    if (threads.empty()) {
+        threads = {1, 2, 4, 8, 16, 32};
+    }
+
+    for (size_t n : threads) {
+        run(n);
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <afina/concurrency/FlatCombine.h>
+
+using namespace Afina::Concurrency;
+using namespace std;
+
+TEST(FlatCombineTest, Exclusive) {
+    FlatCombine<function<void()>> fc;
+    const size_t kThreads = 8;
+    const size_t kOps = 10000;
+
+    // Counter isn't atomic, operations must not overlap
+    size_t counter = 0;
+    vector<thread> threads;
+    for (size_t i = 0; i < kThreads; i++) {
+        threads.emplace_back([&fc, &counter] {
+            function<void()> op = [&counter] { counter++; };
+            for (size_t j = 0; j < kOps; j++) {
+                fc.Execute(op);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(kThreads * kOps, counter);
+
+    // Records of exited threads are reused by new ones
+    thread([&fc, &counter] {
+        function<void()> op = [&counter] { counter = 0; };
+        fc.Execute(op);
+    }).join();
+    EXPECT_EQ(0, counter);
+}
+
+TEST(FlatCombineTest, Exception) {
+    FlatCombine<function<void()>> fc;
+    function<void()> op = [] { throw runtime_error("failed"); };
+    EXPECT_THROW(fc.Execute(op), runtime_error);
+
+    // Error is delivered once
+    bool done = false;
+    op = [&done] { done = true; };
+    fc.Execute(op);
+    EXPECT_TRUE(done);
+}
@@ -0,0 +1,69 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <afina/concurrency/IdAllocator.h>
+
+using namespace Afina::Concurrency;
+
+// Compares throughput of id generation by the single shared atomic counter against IdAllocator, which takes
+// ids from the shared counter by per thread blocks.
+//
+// Usage: runIdBenchmark [number of threads...], by default 1, 2, 4, 8, 16 and 32 threads are measured
+
+namespace {
+
+const size_t kIdsPerThread = 5000000;
+
+// Runs f on n threads, returns millions of ids per second taken by all of them together
+template <typename F> double measure(size_t n_threads, F next_id) {
+    std::atomic<uint64_t> sink(0);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < n_threads; i++) {
+        threads.emplace_back([&sink, &next_id] {
+            uint64_t sum = 0;
+            for (size_t j = 0; j < kIdsPerThread; j++) {
+                sum += next_id();
+            }
+            sink += sum;
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return n_threads * kIdsPerThread / std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+void run(size_t n_threads) {
+    std::atomic<uint64_t> counter(1);
+    double atomic_rate = measure(n_threads, [&counter] { return counter.fetch_add(1, std::memory_order_relaxed); });
+
+    IdAllocator ids;
+    double local_rate = measure(n_threads, [&ids] { return ids.Next(); });
+
+    std::cout << n_threads << " threads: atomic " << atomic_rate << " M ids/s, IdAllocator " << local_rate
+              << " M ids/s, x" << local_rate / atomic_rate << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    std::vector<size_t> threads;
+    for (int i = 1; i < argc; i++) {
+        threads.push_back(std::strtoull(argv[i], nullptr, 10));
+    }
+    if (threads.empty()) {
+        threads = {1, 2, 4, 8, 16, 32};
+    }
+
+    for (size_t n : threads) {
+        run(n);
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <afina/concurrency/IdAllocator.h>
+#include <afina/concurrency/ThreadLocal.h>
+
+using namespace Afina::Concurrency;
+using namespace std;
+
+namespace {
+
+// Counts live instances
+struct tracked {
+    tracked(atomic<int> &live) : live(live), value(0) { live++; }
+    ~tracked() { live--; }
+
+    atomic<int> &live;
+    int value;
+};
+
+} // namespace
+
+TEST(ThreadLocalTest, ValuePerThread) {
+    atomic<int> live(0);
+    {
+        ThreadLocal<tracked> local([&live] { return new tracked(live); });
+        local->value = 1;
+        EXPECT_EQ(1, live);
+
+        // Each thread gets its own value, which is freed once thread exits
+        vector<thread> threads;
+        for (int i = 0; i < 4; i++) {
+            threads.emplace_back([&local, i] {
+                EXPECT_EQ(0, local->value);
+                local->value = i + 10;
+                EXPECT_EQ(i + 10, local.get().value);
+            });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+        EXPECT_EQ(1, live);
+        EXPECT_EQ(1, local->value);
+
+        int sum = 0;
+        local.ForEach([&sum](tracked &t) { sum += t.value; });
+        EXPECT_EQ(1, sum);
+
+        // Objects don't share values
+        ThreadLocal<tracked> other([&live] { return new tracked(live); });
+        EXPECT_EQ(0, other->value);
+        EXPECT_EQ(2, live);
+    }
+    // Values of still running threads are freed with the object
+    EXPECT_EQ(0, live);
+}
+
+TEST(ThreadLocalTest, UniqueIds) {
+    IdAllocator ids(16);
+    const size_t kThreads = 8;
+    const size_t kIds = 10000;
+
+    vector<vector<uint64_t>> taken(kThreads);
+    vector<thread> threads;
+    for (size_t i = 0; i < kThreads; i++) {
+        threads.emplace_back([&ids, &taken, i] {
+            for (size_t j = 0; j < kIds; j++) {
+                taken[i].push_back(ids.Next());
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    set<uint64_t> all;
+    for (auto &v : taken) {
+        for (size_t j = 0; j < v.size(); j++) {
+            EXPECT_NE(0, v[j]);
+            if (j > 0) {
+                EXPECT_LT(v[j - 1], v[j]);
+            }
+            all.insert(v[j]);
+        }
+    }
+    EXPECT_EQ(kThreads * kIds, all.size());
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <afina/execute/Add.h>
+#include <afina/execute/Append.h>
+#include <afina/execute/Cas.h>
+#include <afina/execute/Decr.h>
+#include <afina/execute/Get.h>
+#include <afina/execute/Incr.h>
+#include <afina/execute/Replace.h>
+#include <afina/execute/Response.h>
+#include <afina/execute/Set.h>
+
+#include "storage/SimpleLRU.h"
+
+using namespace Afina;
+
+// Verify memcached expiration time is converted into storage one
+TEST(ExecuteTest, SetExpire) {
+    Backend::SimpleLRU storage;
+    std::string out, value;
+
+    Execute::Set(std::string("never"), 0, 0).Execute(storage, "val\r\n", out);
+    ASSERT_EQ("STORED", out);
+    Execute::Set(std::string("relative"), 0, 3600).Execute(storage, "val\r\n", out);
+    Execute::Set(std::string("negative"), 0, -1).Execute(storage, "val\r\n", out);
+    ASSERT_EQ("STORED", out);
+
+    // Larger than 30 days is absolute time, that one is in 1970
+    Execute::Set(std::string("absolute"), 0, 60 * 60 * 24 * 30 + 1).Execute(storage, "val\r\n", out);
+
+    EXPECT_TRUE(storage.Get("never", value));
+    EXPECT_TRUE(storage.Get("relative", value));
+    EXPECT_FALSE(storage.Get("negative", value));
+    EXPECT_FALSE(storage.Get("absolute", value));
+}
+
+// Verify conditional commands treat expired item as absent
+TEST(ExecuteTest, AddReplaceExpired) {
+    Backend::SimpleLRU storage;
+    std::string out, value;
+
+    Execute::Set(std::string("key"), 0, -1).Execute(storage, "val\r\n", out);
+    Execute::Replace(std::string("key"), 0, 0).Execute(storage, "val2\r\n", out);
+    ASSERT_EQ("NOT_STORED", out);
+    Execute::Add(std::string("key"), 0, 0).Execute(storage, "val3\r\n", out);
+    ASSERT_EQ("STORED", out);
+    ASSERT_TRUE(storage.Get("key", value));
+    ASSERT_EQ("val3", value);
+}
+
+// Verify client flags are stored and returned by get
+TEST(ExecuteTest, GetFlags) {
+    Backend::SimpleLRU storage;
+    std::string out;
+
+    Execute::Set(std::string("key"), 12345, 0).Execute(storage, "val\r\n", out);
+    Execute::Get({"key"}).Execute(storage, "", out);
+    ASSERT_EQ("VALUE key 12345 3\r\nval\r\nEND", out);
+
+    // Append keeps flags of the item
+    Execute::Append(std::string("key"), 1, 0).Execute(storage, "ue\r\n", out);
+    Execute::Get({"key"}).Execute(storage, "", out);
+    ASSERT_EQ("VALUE key 12345 5\r\nvalue\r\nEND", out);
+}
+
+// Verify get puts values into the response without copying and response is consumed chunk by chunk
+TEST(ExecuteTest, GetResponse) {
+    Backend::SimpleLRU storage;
+    std::string out;
+
+    Execute::Set(std::string("key"), 0, 0).Execute(storage, "value\r\n", out);
+    Execute::Response response;
+    Execute::Get({"key", "missing"}).Execute(storage, "", response);
+    ASSERT_EQ("VALUE key 0 5\r\nvalue\r\nEND", response.ToString());
+    ASSERT_EQ(response.ToString().size(), response.size());
+
+    iovec iov[8];
+    ASSERT_EQ(3, response.Prepare(iov, 8));
+    ASSERT_EQ("value", std::string(static_cast<char *>(iov[1].iov_base), iov[1].iov_len));
+
+    // Pinned value survives overwrite
+    Execute::Set(std::string("key"), 0, 0).Execute(storage, "VALUE\r\n", out);
+    response.Consume(17);
+    ASSERT_EQ("lue\r\nEND", response.ToString());
+    ASSERT_EQ(2, response.Prepare(iov, 8));
+    response.Consume(8);
+    ASSERT_TRUE(response.empty());
+}
+
+// Verify multi-get returns found keys in request order
+TEST(ExecuteTest, MultiGet) {
+    Backend::SimpleLRU storage;
+    std::string out;
+
+    Execute::Set(std::string("a"), 1, 0).Execute(storage, "x\r\n", out);
+    Execute::Set(std::string("b"), 2, 0).Execute(storage, "yy\r\n", out);
+    Execute::Get({"b", "missing", "a", "b"}).Execute(storage, "", out);
+    ASSERT_EQ("VALUE b 2 2\r\nyy\r\nVALUE a 1 1\r\nx\r\nVALUE b 2 2\r\nyy\r\nEND", out);
+}
+
+// Verify incr/decr responses
+TEST(ExecuteTest, IncrDecr) {
+    Backend::SimpleLRU storage;
+    std::string out;
+
+    Execute::Incr(std::string("counter"), 1).Execute(storage, "", out);
+    ASSERT_EQ("NOT_FOUND", out);
+    Execute::Set(std::string("counter"), 0, 0).Execute(storage, "99\r\n", out);
+    Execute::Incr(std::string("counter"), 1).Execute(storage, "", out);
+    ASSERT_EQ("100", out);
+    Execute::Decr(std::string("counter"), 200).Execute(storage, "", out);
+    ASSERT_EQ("0", out);
+
+    Execute::Set(std::string("text"), 0, 0).Execute(storage, "abc\r\n", out);
+    Execute::Incr(std::string("text"), 1).Execute(storage, "", out);
+    ASSERT_EQ("CLIENT_ERROR cannot increment or decrement non-numeric value", out);
+}
+
+// Verify gets returns versions accepted by cas
+TEST(ExecuteTest, GetsCas) {
+    Backend::SimpleLRU storage;
+    std::string out;
+
+    Execute::Cas(std::string("key"), 0, 0, 1).Execute(storage, "val\r\n", out);
+    ASSERT_EQ("NOT_FOUND", out);
+
+    Execute::Set(std::string("key"), 3, 0).Execute(storage, "val\r\n", out);
+    Execute::Get({"key"}, true).Execute(storage, "", out);
+    size_t pos = out.find("\r\n");
+    ASSERT_EQ(0, out.find("VALUE key 3 3 "));
+    uint64_t cas = std::stoull(out.substr(14, pos - 14));
+
+    Execute::Cas(std::string("key"), 4, 0, cas).Execute(storage, "new\r\n", out);
+    ASSERT_EQ("STORED", out);
+    Execute::Cas(std::string("key"), 4, 0, cas).Execute(storage, "old\r\n", out);
+    ASSERT_EQ("EXISTS", out);
+    Execute::Get({"key"}).Execute(storage, "", out);
+    ASSERT_EQ("VALUE key 4 3\r\nnew\r\nEND", out);
+}
@@ -4,7 +4,11 @@
 #include <string>
 
 #include <afina/execute/Add.h>
+#include <afina/execute/Cas.h>
 #include <afina/execute/Get.h>
+#include <afina/execute/Incr.h>
+#include <afina/execute/Prepend.h>
+#include <afina/execute/Replace.h>
 #include <afina/execute/Set.h>
 #include <afina/execute/Stats.h>
 
@@ -58,6 +62,87 @@ TEST(MemcachedParserTest, SimpleAdd) {
     ASSERT_EQ(-1, tmp->expire());
 }
 
+// Verify replace and prepend are built into their commands
+TEST(MemcachedParserTest, ReplacePrepend) {
+    Protocol::Parser parser;
+
+    size_t consumed = 0;
+    ASSERT_TRUE(parser.Parse("replace foo 1 0 3\r\n", consumed));
+    size_t value_size;
+    std::unique_ptr<Execute::Command> cmd = parser.Build(value_size);
+    ASSERT_TRUE(dynamic_cast<Execute::Replace *>(cmd.get()) != nullptr);
+    ASSERT_EQ(3, value_size);
+
+    parser.Reset();
+    ASSERT_TRUE(parser.Parse("prepend foo 0 0 2\r\n", consumed));
+    cmd = parser.Build(value_size);
+    ASSERT_TRUE(dynamic_cast<Execute::Prepend *>(cmd.get()) != nullptr);
+    ASSERT_EQ(2, value_size);
+}
+
+// Verify incr with 64 bit delta
+TEST(MemcachedParserTest, Incr) {
+    Protocol::Parser parser;
+
+    size_t consumed = 0;
+    ASSERT_TRUE(parser.Parse("incr counter 18446744073709551615\r\n", consumed));
+    ASSERT_EQ("incr", parser.Name());
+    size_t value_size;
+    std::unique_ptr<Execute::Command> cmd = parser.Build(value_size);
+    ASSERT_EQ(0, value_size);
+
+    Execute::Incr *tmp = dynamic_cast<Execute::Incr *>(cmd.get());
+    ASSERT_TRUE(tmp != nullptr);
+    ASSERT_EQ("counter", tmp->key());
+    ASSERT_EQ(18446744073709551615ULL, tmp->delta());
+
+    parser.Reset();
+    ASSERT_THROW(parser.Parse("decr counter 18446744073709551616\r\n", consumed), std::runtime_error);
+}
+
+// Verify cas command carries version and gets asks for versions
+TEST(MemcachedParserTest, CasGets) {
+    Protocol::Parser parser;
+
+    size_t consumed = 0;
+    ASSERT_TRUE(parser.Parse("cas foo 5 0 3 18446744073709551615\r\n", consumed));
+    size_t value_size;
+    std::unique_ptr<Execute::Command> cmd = parser.Build(value_size);
+    ASSERT_EQ(3, value_size);
+    Execute::Cas *cas = dynamic_cast<Execute::Cas *>(cmd.get());
+    ASSERT_TRUE(cas != nullptr);
+    ASSERT_EQ("foo", cas->key());
+    ASSERT_EQ(5, cas->flags());
+    ASSERT_EQ(18446744073709551615ULL, cas->cas());
+
+    parser.Reset();
+    ASSERT_TRUE(parser.Parse("gets foo bar\r\n", consumed));
+    cmd = parser.Build(value_size);
+    Execute::Get *gets = dynamic_cast<Execute::Get *>(cmd.get());
+    ASSERT_TRUE(gets != nullptr);
+    ASSERT_TRUE(gets->with_cas());
+    ASSERT_EQ(2, gets->keys().size());
+}
+
+// Verify multi digit expiration time
+TEST(MemcachedParserTest, ExpireTime) {
+    Protocol::Parser parser;
+
+    size_t consumed = 0;
+    ASSERT_TRUE(parser.Parse("set foo 0 3600 6\r\n", consumed));
+    size_t value_size;
+    std::unique_ptr<Execute::Command> cmd = parser.Build(value_size);
+    ASSERT_EQ(3600, reinterpret_cast<Execute::Set *>(cmd.get())->expire());
+
+    parser.Reset();
+    ASSERT_TRUE(parser.Parse("set foo 0 -120 6\r\n", consumed));
+    cmd = parser.Build(value_size);
+    ASSERT_EQ(-120, reinterpret_cast<Execute::Set *>(cmd.get())->expire());
+
+    parser.Reset();
+    ASSERT_THROW(parser.Parse("set foo 0 99999999999 6\r\n", consumed), std::runtime_error);
+}
+
 // Verify simple get command passed in a single string
 TEST(MemcachedParserTest, SimpleGet) {
     Protocol::Parser parser;
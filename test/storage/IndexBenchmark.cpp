@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "storage/HashIndex.h"
+
+using namespace Afina::Backend;
+
+// Compares lookup latency of the std::map based index SimpleLRU used to have against HashIndex.
+//
+// Usage: runIndexBenchmark [number of keys...], by default 10K, 1M and 10M keys are measured
+
+namespace {
+
+struct node {
+    std::string key;
+    size_t value;
+};
+
+struct node_key {
+    std::pair<const char *, size_t> operator()(const node &n) const { return std::make_pair(n.key.data(), n.key.size()); }
+};
+
+typedef std::map<std::reference_wrapper<const std::string>, std::reference_wrapper<node>, std::less<std::string>>
+    map_index;
+
+const size_t kLookups = 2000000;
+
+template <typename F> double measure(const std::vector<size_t> &order, F lookup) {
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i : order) {
+        found += lookup(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (found != order.size()) {
+        std::cerr << "Lookup failed: " << found << " of " << order.size() << std::endl;
+        std::exit(1);
+    }
+    return std::chrono::duration<double, std::nano>(end - start).count() / order.size();
+}
+
+void run(size_t n_keys) {
+    std::vector<node> nodes(n_keys);
+    for (size_t i = 0; i < n_keys; i++) {
+        nodes[i].key = "user:session:" + std::to_string(i * 2654435761ULL % 1000000007ULL);
+        nodes[i].value = i;
+    }
+
+    std::mt19937_64 rnd(n_keys);
+    std::vector<size_t> order(kLookups);
+    for (auto &i : order) {
+        i = rnd() % n_keys;
+    }
+
+    double map_ns, hash_ns;
+    {
+        map_index index;
+        for (auto &n : nodes) {
+            index.insert({std::cref(n.key), std::ref(n)});
+        }
+        map_ns = measure(order, [&index, &nodes](size_t i) {
+            auto it = index.find(nodes[i].key);
+            return it != index.end() && it->second.get().value == i;
+        });
+    }
+    {
+        HashIndex<node, node_key> index;
+        for (auto &n : nodes) {
+            index.Insert(&n, HashKey(n.key));
+        }
+        hash_ns = measure(order, [&index, &nodes](size_t i) {
+            node *n = index.Find(nodes[i].key);
+            return n != nullptr && n->value == i;
+        });
+    }
+
+    std::cout << n_keys << " keys: std::map " << map_ns << " ns/lookup, HashIndex " << hash_ns << " ns/lookup, x"
+              << map_ns / hash_ns << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; i++) {
+        sizes.push_back(std::strtoull(argv[i], nullptr, 10));
+    }
+    if (sizes.empty()) {
+        sizes = {10000, 1000000, 10000000};
+    }
+
+    for (size_t n : sizes) {
+        run(n);
+    }
+    return 0;
+}
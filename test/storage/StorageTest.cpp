@@ -1,7 +1,10 @@
 #include "gtest/gtest.h"
+#include <atomic>
+#include <ctime>
 #include <iomanip>
 #include <iostream>
 #include <set>
+#include <thread>
 #include <vector>
 
 #include <afina/execute/Add.h>
@@ -10,14 +13,29 @@
 #include <afina/execute/Get.h>
 #include <afina/execute/Set.h>
 
+#include "storage/ExpirySweeper.h"
+#include "storage/FlatCombineLRU.h"
+#include "storage/FrequencySketch.h"
+#include "storage/HashIndex.h"
+#include "storage/ShardedLRU.h"
+#include "storage/SimpleClock.h"
 #include "storage/SimpleLRU.h"
+#include "storage/ThreadSafeSimpleClock.h"
+#include "storage/ThreadSafeSimpleLRU.h"
 
 using namespace Afina::Backend;
 using namespace Afina::Execute;
 using namespace std;
 
-TEST(StorageTest, PutGet) {
-    SimpleLRU storage;
+// Basic API tests are run against every storage implementation
+template <typename T> class StorageTest : public ::testing::Test {};
+
+typedef ::testing::Types<SimpleLRU, ThreadSafeSimplLRU, FlatCombineLRU, ShardedLRU, SimpleClock, ThreadSafeSimpleClock>
+    StorageTypes;
+TYPED_TEST_CASE(StorageTest, StorageTypes);
+
+TYPED_TEST(StorageTest, PutGet) {
+    TypeParam storage;
 
     EXPECT_TRUE(storage.Put("KEY1", "val1"));
     EXPECT_TRUE(storage.Put("KEY2", "val2"));
@@ -29,8 +47,8 @@ TEST(StorageTest, PutGet) {
     EXPECT_TRUE(value == "val2");
 }
 
-TEST(StorageTest, PutOverwrite) {
-    SimpleLRU storage;
+TYPED_TEST(StorageTest, PutOverwrite) {
+    TypeParam storage;
 
     EXPECT_TRUE(storage.Put("KEY1", "val1"));
     EXPECT_TRUE(storage.Put("KEY1", "val2"));
@@ -40,8 +58,8 @@ TEST(StorageTest, PutOverwrite) {
     EXPECT_TRUE(value == "val2");
 }
 
-TEST(StorageTest, PutIfAbsent) {
-    SimpleLRU storage;
+TYPED_TEST(StorageTest, PutIfAbsent) {
+    TypeParam storage;
 
     EXPECT_TRUE(storage.PutIfAbsent("KEY1", "val1"));
 
@@ -52,8 +70,8 @@ TEST(StorageTest, PutIfAbsent) {
     EXPECT_TRUE(value == "val1");
 }
 
-TEST(StorageTest, PutSetGet) {
-    SimpleLRU storage;
+TYPED_TEST(StorageTest, PutSetGet) {
+    TypeParam storage;
 
     EXPECT_TRUE(storage.Put("KEY1", "val1"));
     EXPECT_TRUE(storage.Set("KEY1", "val2"));
@@ -65,8 +83,8 @@ TEST(StorageTest, PutSetGet) {
     EXPECT_TRUE(value == "val2");
 }
 
-TEST(StorageTest, SetIfAbsent) {
-    SimpleLRU storage;
+TYPED_TEST(StorageTest, SetIfAbsent) {
+    TypeParam storage;
 
     EXPECT_TRUE(storage.Put("KEY1", "val1"));
 
@@ -76,8 +94,8 @@ TEST(StorageTest, SetIfAbsent) {
     EXPECT_TRUE(value == "val1");
 }
 
-TEST(StorageTest, PutDeleteGet) {
-    SimpleLRU storage;
+TYPED_TEST(StorageTest, PutDeleteGet) {
+    TypeParam storage;
 
     EXPECT_TRUE(storage.Put("KEY1", "val1"));
     EXPECT_TRUE(storage.Put("KEY2", "val2"));
@@ -90,6 +108,217 @@ TEST(StorageTest, PutDeleteGet) {
     EXPECT_TRUE(value == "val2");
 }
 
+TYPED_TEST(StorageTest, Expire) {
+    TypeParam storage;
+    uint32_t past = std::time(nullptr) - 1;
+    uint32_t future = std::time(nullptr) + 3600;
+
+    EXPECT_TRUE(storage.Put("KEY1", "val1", past));
+    EXPECT_TRUE(storage.Put("KEY2", "val2", future));
+
+    std::string value;
+    EXPECT_FALSE(storage.Get("KEY1", value));
+    EXPECT_TRUE(storage.Get("KEY2", value));
+    EXPECT_TRUE(value == "val2");
+
+    // Expired item is absent for every operation
+    EXPECT_TRUE(storage.Put("KEY1", "val1", past));
+    EXPECT_FALSE(storage.Set("KEY1", "val1"));
+    EXPECT_TRUE(storage.Put("KEY1", "val1", past));
+    EXPECT_FALSE(storage.Delete("KEY1"));
+    EXPECT_TRUE(storage.Put("KEY1", "val1", past));
+    EXPECT_TRUE(storage.PutIfAbsent("KEY1", "val3"));
+    EXPECT_TRUE(storage.Get("KEY1", value));
+    EXPECT_TRUE(value == "val3");
+
+    // Update replaces expiration time
+    EXPECT_TRUE(storage.Set("KEY2", "val2", past));
+    EXPECT_FALSE(storage.Get("KEY2", value));
+}
+
+TYPED_TEST(StorageTest, Flags) {
+    TypeParam storage;
+    EXPECT_TRUE(storage.Put("KEY1", "val1", 0, 42));
+    EXPECT_TRUE(storage.PutIfAbsent("KEY2", "val2", 0, 0xffffffff));
+
+    std::string value;
+    uint32_t flags = 0;
+    EXPECT_TRUE(storage.Get("KEY1", value, &flags));
+    EXPECT_EQ(42, flags);
+    EXPECT_TRUE(storage.Get("KEY2", value, &flags));
+    EXPECT_EQ(0xffffffff, flags);
+
+    // Update replaces flags both in place and with reallocation
+    EXPECT_TRUE(storage.Set("KEY1", "VAL1", 0, 7));
+    EXPECT_TRUE(storage.Get("KEY1", value, &flags));
+    EXPECT_EQ(7, flags);
+    EXPECT_TRUE(storage.Put("KEY1", std::string(40, 'v'), 0, 8));
+    EXPECT_TRUE(storage.Get("KEY1", value, &flags));
+    EXPECT_EQ(8, flags);
+    EXPECT_TRUE(value == std::string(40, 'v'));
+}
+
+TYPED_TEST(StorageTest, GetRefPinsValue) {
+    TypeParam storage;
+    EXPECT_TRUE(storage.Put("KEY1", "val1", 0, 5));
+
+    Afina::ItemRef item;
+    EXPECT_FALSE(storage.GetRef("KEY2", item));
+    EXPECT_TRUE(item.empty());
+    EXPECT_TRUE(storage.GetRef("KEY1", item));
+    EXPECT_EQ(5, item.flags());
+    EXPECT_EQ("val1", std::string(item.data(), item.size()));
+
+    // Neither overwrite nor delete touch the pinned value
+    EXPECT_TRUE(storage.Set("KEY1", "VAL1"));
+    EXPECT_EQ("val1", std::string(item.data(), item.size()));
+    EXPECT_TRUE(storage.Delete("KEY1"));
+    EXPECT_EQ("val1", std::string(item.data(), item.size()));
+
+    // Moved handle keeps the pin, pinned item could outlive the storage as well
+    Afina::ItemRef outlived;
+    {
+        TypeParam other;
+        EXPECT_TRUE(other.Put("KEY2", "val2"));
+        EXPECT_TRUE(other.GetRef("KEY2", item));
+        outlived = std::move(item);
+        EXPECT_TRUE(item.empty());
+    }
+    EXPECT_EQ("val2", std::string(outlived.data(), outlived.size()));
+}
+
+TYPED_TEST(StorageTest, MultiGet) {
+    TypeParam storage;
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < 40; i++) {
+        keys.push_back("KEY" + std::to_string(i % 8));
+    }
+    for (size_t i = 0; i < 6; i++) {
+        storage.Put("KEY" + std::to_string(i), "val" + std::to_string(i), 0, i);
+    }
+
+    // Result must match separate lookups, whatever has been evicted
+    std::vector<Afina::ItemRef> items;
+    size_t found = storage.MultiGet(keys, items);
+    ASSERT_EQ(keys.size(), items.size());
+    size_t expected = 0;
+    for (size_t i = 0; i < keys.size(); i++) {
+        std::string value;
+        uint32_t flags;
+        bool present = storage.Get(keys[i], value, &flags);
+        ASSERT_EQ(present, !items[i].empty());
+        if (present) {
+            expected++;
+            EXPECT_EQ(value, std::string(items[i].data(), items[i].size()));
+            EXPECT_EQ(flags, items[i].flags());
+        }
+    }
+    EXPECT_EQ(expected, found);
+    EXPECT_GT(found, 0);
+}
+
+TYPED_TEST(StorageTest, AppendPrepend) {
+    TypeParam storage;
+    uint32_t future = std::time(nullptr) + 3600;
+    EXPECT_FALSE(storage.Append("KEY1", "tail"));
+    EXPECT_FALSE(storage.Prepend("KEY1", "head"));
+    EXPECT_TRUE(storage.Put("KEY1", "val", future, 3));
+
+    // Value pinned before update must not change
+    Afina::ItemRef pinned;
+    EXPECT_TRUE(storage.GetRef("KEY1", pinned));
+
+    EXPECT_TRUE(storage.Append("KEY1", "ue"));
+    EXPECT_TRUE(storage.Prepend("KEY1", "<"));
+    for (int i = 0; i < 5; i++) {
+        EXPECT_TRUE(storage.Append("KEY1", ">"));
+    }
+    EXPECT_EQ("val", std::string(pinned.data(), pinned.size()));
+
+    std::string value;
+    uint32_t flags;
+    EXPECT_TRUE(storage.Get("KEY1", value, &flags));
+    EXPECT_EQ("<value>>>>>", value);
+    EXPECT_EQ(3, flags);
+
+    // Expired item is absent for append
+    uint32_t past = std::time(nullptr) - 1;
+    EXPECT_TRUE(storage.Put("KEY2", "val", past));
+    EXPECT_FALSE(storage.Append("KEY2", "ue"));
+    EXPECT_FALSE(storage.Get("KEY2", value));
+}
+
+TYPED_TEST(StorageTest, IncrDecr) {
+    TypeParam storage;
+    uint64_t result;
+    EXPECT_FALSE(storage.Incr("KEY1", 1, result));
+    EXPECT_TRUE(storage.Put("KEY1", "9", 0, 7));
+
+    EXPECT_TRUE(storage.Incr("KEY1", 1, result));
+    EXPECT_EQ(10, result);
+    EXPECT_TRUE(storage.Decr("KEY1", 3, result));
+    EXPECT_EQ(7, result);
+    EXPECT_TRUE(storage.Decr("KEY1", 100, result));
+    EXPECT_EQ(0, result);
+
+    // 64 bit wrap around
+    EXPECT_TRUE(storage.Set("KEY1", "18446744073709551615", 0, 7));
+    EXPECT_TRUE(storage.Incr("KEY1", 2, result));
+    EXPECT_EQ(1, result);
+
+    // Pinned value isn't rewritten, flags are kept
+    Afina::ItemRef pinned;
+    EXPECT_TRUE(storage.GetRef("KEY1", pinned));
+    EXPECT_TRUE(storage.Incr("KEY1", 1, result));
+    EXPECT_EQ("1", std::string(pinned.data(), pinned.size()));
+
+    std::string value;
+    uint32_t flags;
+    EXPECT_TRUE(storage.Get("KEY1", value, &flags));
+    EXPECT_EQ("2", value);
+    EXPECT_EQ(7, flags);
+
+    EXPECT_TRUE(storage.Put("KEY2", "12a"));
+    EXPECT_THROW(storage.Incr("KEY2", 1, result), std::invalid_argument);
+    EXPECT_TRUE(storage.Put("KEY2", "18446744073709551616"));
+    EXPECT_THROW(storage.Decr("KEY2", 1, result), std::invalid_argument);
+}
+
+TYPED_TEST(StorageTest, Cas) {
+    TypeParam storage;
+    EXPECT_TRUE(Afina::Storage::CasResult::kNotFound == storage.Cas("KEY1", "val", 1));
+    EXPECT_TRUE(storage.Put("KEY1", "val1"));
+
+    Afina::ItemRef item;
+    EXPECT_TRUE(storage.GetRef("KEY1", item));
+    uint64_t version = item.cas();
+    EXPECT_NE(0, version);
+
+    // Reads don't change version, any update does
+    EXPECT_TRUE(storage.GetRef("KEY1", item));
+    EXPECT_EQ(version, item.cas());
+    EXPECT_TRUE(storage.Append("KEY1", "1"));
+    EXPECT_TRUE(Afina::Storage::CasResult::kExists == storage.Cas("KEY1", "val2", version));
+
+    EXPECT_TRUE(storage.GetRef("KEY1", item));
+    version = item.cas();
+    EXPECT_TRUE(Afina::Storage::CasResult::kStored == storage.Cas("KEY1", "val2", version, 0, 9));
+    EXPECT_TRUE(Afina::Storage::CasResult::kExists == storage.Cas("KEY1", "val3", version));
+
+    std::string value;
+    uint32_t flags;
+    EXPECT_TRUE(storage.Get("KEY1", value, &flags));
+    EXPECT_EQ("val2", value);
+    EXPECT_EQ(9, flags);
+
+    // Re-created item doesn't get an old version back
+    EXPECT_TRUE(storage.GetRef("KEY1", item));
+    version = item.cas();
+    EXPECT_TRUE(storage.Delete("KEY1"));
+    EXPECT_TRUE(storage.Put("KEY1", "val2", 0, 9));
+    EXPECT_TRUE(Afina::Storage::CasResult::kExists == storage.Cas("KEY1", "val3", version));
+}
+
 std::string pad_space(const std::string &s, size_t length) {
     std::string result = s;
     result.resize(length, ' ');
@@ -98,7 +327,7 @@ std::string pad_space(const std::string &s, size_t length) {
 
 TEST(StorageTest, BigTest) {
     const size_t length = 20;
-    SimpleLRU storage(2 * 100000 * length);
+    SimpleLRU storage(100000 * SimpleLRU::EntrySize(length, length));
 
     for (long i = 0; i < 100000; ++i) {
         auto key = pad_space("Key " + std::to_string(i), length);
@@ -119,7 +348,7 @@ TEST(StorageTest, BigTest) {
 
 TEST(StorageTest, MaxTest) {
     const size_t length = 20;
-    SimpleLRU storage(2 * 1000 * length);
+    SimpleLRU storage(1000 * SimpleLRU::EntrySize(length, length));
 
     std::stringstream ss;
 
@@ -146,3 +375,379 @@ TEST(StorageTest, MaxTest) {
         EXPECT_FALSE(storage.Get(key, res));
     }
 }
+
+TEST(StorageTest, SizeIncludesOverhead) {
+    SimpleLRU storage(1024);
+
+    EXPECT_TRUE(storage.Put("KEY1", "val1"));
+    EXPECT_EQ(SimpleLRU::EntrySize(4, 4), storage.Size());
+    EXPECT_GT(SimpleLRU::EntrySize(4, 4), 8);
+
+    // Value that fits into the existing node is updated in place
+    EXPECT_TRUE(storage.Put("KEY1", "v2"));
+    EXPECT_EQ(SimpleLRU::EntrySize(4, 4), storage.Size());
+
+    // Bigger one requires node to be reallocated
+    EXPECT_TRUE(storage.Put("KEY1", "value3"));
+    EXPECT_EQ(SimpleLRU::EntrySize(4, 6), storage.Size());
+
+    std::string value;
+    EXPECT_TRUE(storage.Get("KEY1", value));
+    EXPECT_EQ("value3", value);
+
+    EXPECT_TRUE(storage.Delete("KEY1"));
+    EXPECT_EQ(0, storage.Size());
+}
+
+TEST(StorageTest, ShardedSplitsMemory) {
+    const size_t length = 20;
+    ShardedLRU storage(1000 * SimpleLRU::EntrySize(length, length), 4);
+    ASSERT_EQ(4, storage.ShardsCount());
+
+    // Whole budget can't be used by a single shard
+    for (long i = 0; i < 1000; ++i) {
+        auto key = pad_space("Key " + std::to_string(i), length);
+        auto val = pad_space("Val " + std::to_string(i), length);
+        EXPECT_TRUE(storage.Put(key, val));
+    }
+
+    size_t found = 0;
+    for (long i = 0; i < 1000; ++i) {
+        auto key = pad_space("Key " + std::to_string(i), length);
+        std::string res;
+        if (storage.Get(key, res)) {
+            found++;
+        }
+    }
+    EXPECT_LT(found, 1000);
+    EXPECT_GT(found, 500);
+
+    // Value that doesn't fit into one shard is rejected
+    EXPECT_FALSE(storage.Put("big", std::string(500 * SimpleLRU::EntrySize(length, length), 'x')));
+}
+
+TEST(StorageTest, ShardedConcurrent) {
+    const size_t length = 20;
+    const long per_thread = 10000;
+    ShardedLRU storage(2 * 4 * per_thread * SimpleLRU::EntrySize(length, length), 16);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&storage, t, length, per_thread]() {
+            for (long i = 0; i < per_thread; ++i) {
+                auto key = pad_space("Key " + std::to_string(t) + " " + std::to_string(i), length);
+                auto val = pad_space("Val " + std::to_string(i), length);
+                EXPECT_TRUE(storage.Put(key, val));
+
+                std::string res;
+                EXPECT_TRUE(storage.Get(key, res));
+                EXPECT_TRUE(val == res);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    for (int t = 0; t < 4; t++) {
+        for (long i = 0; i < per_thread; ++i) {
+            auto key = pad_space("Key " + std::to_string(t) + " " + std::to_string(i), length);
+            std::string res;
+            EXPECT_TRUE(storage.Get(key, res));
+        }
+    }
+}
+
+TEST(StorageTest, FlatCombineConcurrent) {
+    FlatCombineLRU storage;
+    EXPECT_TRUE(storage.Put("counter", "0"));
+
+    // Concurrent increments are applied one by one by combiners, none is lost
+    const int per_thread = 10000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&storage, per_thread]() {
+            uint64_t result;
+            for (int i = 0; i < per_thread; ++i) {
+                EXPECT_TRUE(storage.Incr("counter", 1, result));
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    std::string res;
+    EXPECT_TRUE(storage.Get("counter", res));
+    EXPECT_EQ(std::to_string(4 * per_thread), res);
+}
+
+TEST(StorageTest, IndexInsertEraseFind) {
+    struct node {
+        std::string key;
+    };
+    struct node_key {
+        std::pair<const char *, size_t> operator()(const node &n) const {
+            return std::make_pair(n.key.data(), n.key.size());
+        }
+    };
+
+    std::vector<node> nodes(10000);
+    HashIndex<node, node_key> index;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodes[i].key = "Key " + std::to_string(i);
+        index.Insert(&nodes[i], HashKey(nodes[i].key));
+    }
+    EXPECT_EQ(nodes.size(), index.size());
+
+    // Erase every other node, backward shift must keep the rest reachable
+    for (size_t i = 0; i < nodes.size(); i += 2) {
+        EXPECT_TRUE(index.Erase(&nodes[i], HashKey(nodes[i].key)));
+    }
+    EXPECT_FALSE(index.Erase(&nodes[0], HashKey(nodes[0].key)));
+    EXPECT_EQ(nodes.size() / 2, index.size());
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        node *found = index.Find(nodes[i].key);
+        if (i % 2 == 0) {
+            EXPECT_TRUE(found == nullptr);
+        } else {
+            EXPECT_TRUE(found == &nodes[i]);
+        }
+    }
+}
+
+TEST(StorageTest, PromotionMarkGivesSecondChance) {
+    const size_t length = 20;
+    SimpleLRU storage(3 * SimpleLRU::EntrySize(length, length), SimpleLRU::Promotion::kMark);
+
+    auto key = [length](int i) { return pad_space("Key " + std::to_string(i), length); };
+    auto val = [length](int i) { return pad_space("Val " + std::to_string(i), length); };
+
+    EXPECT_TRUE(storage.Put(key(0), val(0)));
+    EXPECT_TRUE(storage.Put(key(1), val(1)));
+    EXPECT_TRUE(storage.Put(key(2), val(2)));
+
+    // Oldest item is referenced, so next one gets evicted instead
+    std::string res;
+    EXPECT_TRUE(storage.Get(key(0), res));
+    EXPECT_TRUE(storage.Put(key(3), val(3)));
+
+    EXPECT_TRUE(storage.Get(key(0), res));
+    EXPECT_FALSE(storage.Get(key(1), res));
+    EXPECT_TRUE(storage.Get(key(2), res));
+    EXPECT_TRUE(storage.Get(key(3), res));
+}
+
+TEST(StorageTest, PromotionInterval) {
+    const size_t length = 20;
+    SimpleLRU storage(3 * SimpleLRU::EntrySize(length, length), SimpleLRU::Promotion::kInterval,
+                      std::chrono::milliseconds{60000});
+
+    auto key = [length](int i) { return pad_space("Key " + std::to_string(i), length); };
+    auto val = [length](int i) { return pad_space("Val " + std::to_string(i), length); };
+
+    EXPECT_TRUE(storage.Put(key(0), val(0)));
+    EXPECT_TRUE(storage.Put(key(1), val(1)));
+    EXPECT_TRUE(storage.Put(key(2), val(2)));
+
+    // Item was promoted recently, so hit doesn't change order
+    std::string res;
+    EXPECT_TRUE(storage.Get(key(0), res));
+    EXPECT_TRUE(storage.Put(key(3), val(3)));
+    EXPECT_FALSE(storage.Get(key(0), res));
+    EXPECT_TRUE(storage.Get(key(1), res));
+
+    SimpleLRU eager(3 * SimpleLRU::EntrySize(length, length), SimpleLRU::Promotion::kInterval,
+                    std::chrono::milliseconds{0});
+    EXPECT_TRUE(eager.Put(key(0), val(0)));
+    EXPECT_TRUE(eager.Put(key(1), val(1)));
+    EXPECT_TRUE(eager.Put(key(2), val(2)));
+    EXPECT_TRUE(eager.Get(key(0), res));
+    EXPECT_TRUE(eager.Put(key(3), val(3)));
+    EXPECT_TRUE(eager.Get(key(0), res));
+    EXPECT_FALSE(eager.Get(key(1), res));
+}
+
+TEST(StorageTest, FrequencySketchEstimate) {
+    FrequencySketch sketch(1024);
+    uint64_t hot = HashKey("hot"), warm = HashKey("warm"), cold = HashKey("cold");
+
+    for (int i = 0; i < 100; i++) {
+        sketch.Increment(hot);
+    }
+    for (int i = 0; i < 3; i++) {
+        sketch.Increment(warm);
+    }
+    EXPECT_EQ(FrequencySketch::kMaxCount, sketch.Estimate(hot));
+    EXPECT_GE(sketch.Estimate(warm), 3);
+    EXPECT_LT(sketch.Estimate(warm), sketch.Estimate(hot));
+    EXPECT_LE(sketch.Estimate(cold), sketch.Estimate(warm));
+
+    // Lots of other keys trigger aging, old popularity fades out
+    for (int i = 0; i < 100000; i++) {
+        sketch.Increment(HashKey(std::to_string(i)));
+    }
+    EXPECT_LT(sketch.Estimate(hot), FrequencySketch::kMaxCount);
+}
+
+TEST(StorageTest, TinyLFUScanResistance) {
+    const size_t length = 20;
+    const size_t capacity = 100;
+    SimpleLRU lru(capacity * SimpleLRU::EntrySize(length, length));
+    SimpleLRU tinylfu(capacity * SimpleLRU::EntrySize(length, length), SimpleLRU::Promotion::kAlways,
+                      std::chrono::milliseconds{60000}, SimpleLRU::Admission::kTinyLFU);
+
+    auto key = [length](int i) { return pad_space("Key " + std::to_string(i), length); };
+    auto val = [length](int i) { return pad_space("Val " + std::to_string(i), length); };
+
+    // Hot set is accessed many times, then single scan over lots of keys happens
+    std::string res;
+    for (auto storage : {&lru, &tinylfu}) {
+        for (int i = 0; i < 20; i++) {
+            EXPECT_TRUE(storage->Put(key(i), val(i)));
+            for (int j = 0; j < 10; j++) {
+                EXPECT_TRUE(storage->Get(key(i), res));
+            }
+        }
+        for (int i = 1000; i < 1300; i++) {
+            EXPECT_FALSE(storage->Get(key(i), res));
+            EXPECT_TRUE(storage->Put(key(i), val(i)));
+        }
+        EXPECT_LE(storage->Size(), capacity * SimpleLRU::EntrySize(length, length));
+    }
+
+    // Plain LRU lost the whole hot set, W-TinyLFU kept it
+    for (int i = 0; i < 20; i++) {
+        EXPECT_FALSE(lru.Get(key(i), res));
+        EXPECT_TRUE(tinylfu.Get(key(i), res));
+        EXPECT_EQ(val(i), res);
+    }
+
+    // Recent scan item is still in the window
+    EXPECT_TRUE(tinylfu.Get(key(1299), res));
+
+    // Regular operations keep working with admission enabled
+    EXPECT_TRUE(tinylfu.Put(key(0), val(0) + val(0)));
+    EXPECT_TRUE(tinylfu.Get(key(0), res));
+    EXPECT_EQ(val(0) + val(0), res);
+    EXPECT_TRUE(tinylfu.Set(key(1299), val(1)));
+    EXPECT_TRUE(tinylfu.Delete(key(1299)));
+    EXPECT_FALSE(tinylfu.Get(key(1299), res));
+    EXPECT_LE(tinylfu.Size(), capacity * SimpleLRU::EntrySize(length, length));
+}
+
+TEST(StorageTest, SweepExpired) {
+    const size_t length = 20;
+    SimpleLRU lru(100 * SimpleLRU::EntrySize(length, length), SimpleLRU::Promotion::kAlways,
+                  std::chrono::milliseconds{60000}, SimpleLRU::Admission::kTinyLFU);
+    SimpleClock clock(100 * SimpleClock::EntrySize(length, length));
+    uint32_t past = std::time(nullptr) - 1;
+
+    auto key = [length](int i) { return pad_space("Key " + std::to_string(i), length); };
+    auto val = [length](int i) { return pad_space("Val " + std::to_string(i), length); };
+
+    // Every third item is expired
+    for (int i = 0; i < 90; i++) {
+        EXPECT_TRUE(lru.Put(key(i), val(i), i % 3 == 0 ? past : 0));
+        EXPECT_TRUE(clock.Put(key(i), val(i), i % 3 == 0 ? past : 0));
+    }
+
+    // Sweeping by small batches continues where the previous one stopped
+    size_t lru_deleted = 0, clock_deleted = 0;
+    for (int i = 0; i < 30; i++) {
+        lru_deleted += lru.SweepExpired(5);
+        clock_deleted += clock.SweepExpired(5);
+    }
+    EXPECT_EQ(30, lru_deleted);
+    EXPECT_EQ(30, clock_deleted);
+    EXPECT_EQ(60 * SimpleLRU::EntrySize(length, length), lru.Size());
+    EXPECT_EQ(60 * SimpleClock::EntrySize(length, length), clock.Size());
+
+    std::string res;
+    for (int i = 0; i < 90; i++) {
+        EXPECT_EQ(i % 3 != 0, lru.Get(key(i), res));
+        EXPECT_EQ(i % 3 != 0, clock.Get(key(i), res));
+    }
+    EXPECT_EQ(0, lru.SweepExpired(1000));
+    EXPECT_EQ(0, clock.SweepExpired(1000));
+}
+
+TEST(StorageTest, ExpirySweeperThread) {
+    std::atomic<int> sweeps(0);
+    ExpirySweeper sweeper([&sweeps] { sweeps++; }, std::chrono::milliseconds{1});
+    sweeper.Start();
+    while (sweeps < 10) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    sweeper.Stop();
+    int total = sweeps;
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    EXPECT_EQ(total, sweeps);
+
+    // Nobody reads expired items, but storage frees them on its own
+    ThreadSafeSimplLRU storage(1024 * 1024);
+    uint32_t past = std::time(nullptr) - 1;
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(storage.Put("Key " + std::to_string(i), "val", past));
+    }
+    EXPECT_TRUE(storage.Put("Alive", "val"));
+    storage.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds{500});
+    storage.Stop();
+    EXPECT_EQ(SimpleLRU::EntrySize(5, 3), storage.Size());
+}
+
+TEST(StorageTest, ClockMaxTest) {
+    const size_t length = 20;
+    SimpleClock storage(1000 * SimpleClock::EntrySize(length, length));
+
+    // Without reads CLOCK evicts in insertion order
+    for (long i = 0; i < 1100; ++i) {
+        auto key = pad_space("Key " + std::to_string(i), length);
+        auto val = pad_space("Val " + std::to_string(i), length);
+        EXPECT_TRUE(storage.Put(key, val));
+    }
+
+    for (long i = 0; i < 100; ++i) {
+        auto key = pad_space("Key " + std::to_string(i), length);
+        std::string res;
+        EXPECT_FALSE(storage.Get(key, res));
+    }
+
+    for (long i = 100; i < 1100; ++i) {
+        auto key = pad_space("Key " + std::to_string(i), length);
+        auto val = pad_space("Val " + std::to_string(i), length);
+        std::string res;
+        EXPECT_TRUE(storage.Get(key, res));
+        EXPECT_TRUE(val == res);
+    }
+    EXPECT_EQ(1000 * SimpleClock::EntrySize(length, length), storage.Size());
+}
+
+TEST(StorageTest, ClockSecondChance) {
+    const size_t length = 20;
+    SimpleClock storage(3 * SimpleClock::EntrySize(length, length));
+
+    auto key = [length](int i) { return pad_space("Key " + std::to_string(i), length); };
+    auto val = [length](int i) { return pad_space("Val " + std::to_string(i), length); };
+
+    EXPECT_TRUE(storage.Put(key(0), val(0)));
+    EXPECT_TRUE(storage.Put(key(1), val(1)));
+    EXPECT_TRUE(storage.Put(key(2), val(2)));
+
+    // Referenced item survives the sweep, the next one is evicted
+    std::string res;
+    EXPECT_TRUE(storage.Get(key(0), res));
+    EXPECT_TRUE(storage.Put(key(3), val(3)));
+    EXPECT_TRUE(storage.Get(key(0), res));
+    EXPECT_FALSE(storage.Get(key(1), res));
+
+    // Freed slot is reused, bigger value forces node reallocation
+    EXPECT_TRUE(storage.Delete(key(2)));
+    EXPECT_TRUE(storage.Put(key(4), val(4)));
+    EXPECT_TRUE(storage.Put(key(4), val(4) + val(4)));
+    EXPECT_TRUE(storage.Get(key(4), res));
+    EXPECT_EQ(val(4) + val(4), res);
+    EXPECT_LE(storage.Size(), 3 * SimpleClock::EntrySize(length, length));
+}
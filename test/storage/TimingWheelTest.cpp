@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <afina/TimingWheel.h>
+
+using namespace Afina;
+
+namespace {
+
+struct item {
+    uint32_t when;
+    TimerHook<item> hook;
+    int fired = 0;
+};
+
+using wheel = TimingWheel<item, &item::hook, &item::when>;
+
+} // namespace
+
+TEST(TimingWheelTest, ExpiresInOrder) {
+    wheel w(1000);
+    std::vector<item> items(5);
+    uint32_t deadlines[] = {1000, 1001, 1300, 70000, 20000000};
+    for (size_t i = 0; i < items.size(); i++) {
+        items[i].when = deadlines[i];
+        w.Add(items[i]);
+    }
+    EXPECT_EQ(5, w.size());
+
+    std::vector<uint32_t> fired;
+    auto on_expired = [&fired](item &it) { fired.push_back(it.when); };
+
+    EXPECT_EQ(1, w.Advance(1000, on_expired));
+    EXPECT_EQ(1, w.Advance(1299, on_expired));
+    EXPECT_EQ(2, w.Advance(70000, on_expired));
+    EXPECT_EQ(0, w.Advance(20000000 - 1, on_expired));
+    EXPECT_EQ(1, w.Advance(20000000, on_expired));
+    EXPECT_TRUE(w.empty());
+    EXPECT_EQ(std::vector<uint32_t>({1000, 1001, 1300, 70000, 20000000}), fired);
+}
+
+TEST(TimingWheelTest, RemoveAndLimit) {
+    wheel w(0);
+    std::vector<item> items(10);
+    for (auto &it : items) {
+        it.when = 5;
+        w.Add(it);
+    }
+    w.Remove(items[3]);
+    w.Remove(items[3]);
+    EXPECT_FALSE(wheel::Scheduled(items[3]));
+    EXPECT_EQ(9, w.size());
+
+    uint32_t next;
+    ASSERT_TRUE(w.NextExpiration(next));
+    EXPECT_EQ(5, next);
+
+    // Items left due to limit expire on the next call
+    auto on_expired = [](item &it) { it.fired++; };
+    EXPECT_EQ(4, w.Advance(100, on_expired, 4));
+    EXPECT_EQ(5, w.Advance(100, on_expired));
+    EXPECT_FALSE(w.NextExpiration(next));
+    for (size_t i = 0; i < items.size(); i++) {
+        EXPECT_EQ(i == 3 ? 0 : 1, items[i].fired);
+    }
+}
+
+TEST(TimingWheelTest, RandomDeadlinesAcrossWrapAround) {
+    const uint32_t start = 0xffff0000u;
+    wheel w(start);
+    std::mt19937 rnd(7);
+    std::vector<item> items(10000);
+    for (auto &it : items) {
+        it.when = start + rnd() % 300000;
+        w.Add(it);
+    }
+
+    // Every item fires exactly once, no earlier than its deadline and not later than the time passed
+    uint32_t now = start;
+    size_t total = 0;
+    while (!w.empty()) {
+        now += rnd() % 1000;
+        total += w.Advance(now, [now](item &it) {
+            EXPECT_LE(int32_t(it.when - now), 0);
+            it.fired++;
+        });
+        for (auto &it : items) {
+            if (int32_t(it.when - now) <= 0) {
+                ASSERT_EQ(1, it.fired);
+            }
+        }
+    }
+    EXPECT_EQ(items.size(), total);
+}
@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "storage/SimpleClock.h"
+#include "storage/SimpleLRU.h"
+
+using namespace Afina::Backend;
+
+// Replays key access trace against storages with different configurations and reports hit ratio and
+// throughput. Every access is GET, on miss value gets SET into the cache just like client-side caching does.
+//
+// Usage: runTraceBenchmark [trace file], trace file contains one key per line. Without file two synthetic
+// traces are used: Zipf distributed keys, and the same keys mixed with periodic scans over unique keys
+
+namespace {
+
+const size_t kKeys = 100000;
+const size_t kAccesses = 2000000;
+const double kZipfAlpha = 0.99;
+const size_t kValueSize = 100;
+
+// Every kScanPeriod accesses kScanLength never repeated keys are accessed in a row
+const size_t kScanPeriod = 100000;
+const size_t kScanLength = 20000;
+
+// Generates keys indexes with P(i) ~ 1 / (i + 1)^alpha
+class ZipfGenerator {
+public:
+    ZipfGenerator(size_t n, double alpha, uint64_t seed) : _rnd(seed), _cdf(n) {
+        double sum = 0;
+        for (size_t i = 0; i < n; i++) {
+            sum += 1.0 / std::pow(double(i + 1), alpha);
+            _cdf[i] = sum;
+        }
+        for (auto &c : _cdf) {
+            c /= sum;
+        }
+    }
+
+    size_t operator()() {
+        double u = std::uniform_real_distribution<double>(0, 1)(_rnd);
+        return std::min(size_t(std::lower_bound(_cdf.begin(), _cdf.end(), u) - _cdf.begin()), _cdf.size() - 1);
+    }
+
+private:
+    std::mt19937_64 _rnd;
+    std::vector<double> _cdf;
+};
+
+std::string make_key(size_t i) { return "user:" + std::to_string(i * 2654435761ULL % 1000000007ULL); }
+
+std::vector<std::string> synthetic_trace(bool with_scans) {
+    ZipfGenerator zipf(kKeys, kZipfAlpha, 42);
+    std::vector<std::string> trace;
+    trace.reserve(kAccesses);
+    size_t scanned = 0;
+    while (trace.size() < kAccesses) {
+        if (with_scans && trace.size() % kScanPeriod == kScanPeriod - kScanLength) {
+            for (size_t i = 0; i < kScanLength; i++) {
+                trace.push_back("scan:" + std::to_string(scanned++));
+            }
+        } else {
+            trace.push_back(make_key(zipf()));
+        }
+    }
+    return trace;
+}
+
+void replay(const std::string &name, Afina::Storage &storage, const std::vector<std::string> &trace) {
+    const std::string value(kValueSize, 'v');
+    std::string out;
+    size_t hits = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto &key : trace) {
+        if (storage.Get(key, out)) {
+            hits++;
+        } else {
+            storage.Put(key, value);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << name << ": hit ratio " << 100.0 * hits / trace.size() << "%, " << trace.size() / seconds / 1000
+              << " Kops/s" << std::endl;
+}
+
+void run(const std::string &name, const std::vector<std::string> &trace) {
+    // Cache could hold ~10% of the distinct keys
+    size_t max_size = kKeys / 10 * SimpleLRU::EntrySize(make_key(0).size(), kValueSize);
+    std::cout << name << ": " << trace.size() << " accesses, cache size " << max_size << " bytes" << std::endl;
+
+    {
+        SimpleLRU storage(max_size, SimpleLRU::Promotion::kAlways);
+        replay("lru, promote always", storage, trace);
+    }
+    {
+        SimpleLRU storage(max_size, SimpleLRU::Promotion::kInterval, std::chrono::milliseconds{10});
+        replay("lru, promote once per 10ms", storage, trace);
+    }
+    {
+        SimpleLRU storage(max_size, SimpleLRU::Promotion::kMark);
+        replay("lru, mark on hit", storage, trace);
+    }
+    {
+        SimpleClock storage(max_size);
+        replay("clock", storage, trace);
+    }
+    {
+        SimpleLRU storage(max_size, SimpleLRU::Promotion::kAlways, std::chrono::milliseconds{60000},
+                          SimpleLRU::Admission::kTinyLFU);
+        replay("lru + tinylfu, promote always", storage, trace);
+    }
+    {
+        SimpleLRU storage(max_size, SimpleLRU::Promotion::kMark, std::chrono::milliseconds{60000},
+                          SimpleLRU::Admission::kTinyLFU);
+        replay("lru + tinylfu, mark on hit", storage, trace);
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc > 1) {
+        std::vector<std::string> trace;
+        std::ifstream in(argv[1]);
+        std::string key;
+        while (std::getline(in, key)) {
+            trace.push_back(key);
+        }
+        run(argv[1], trace);
+    } else {
+        run("zipf", synthetic_trace(false));
+        run("zipf + scans", synthetic_trace(true));
+    }
+    return 0;
+}